@@ -15,6 +15,7 @@
 #include <benchmark/benchmark.h>
 
 #include <cstdlib>
+#include <random>
 
 #include "fs/fs_util.h"
 #include "storage/chunk_helper.h"
@@ -28,6 +29,9 @@ struct BenchParams {
     size_t key_size;
     uint64_t total_record;
     uint64_t each_upsert_record;
+    // batch size and rounds of random `get` after all records are upserted, 0 to skip.
+    uint64_t each_get_record = 0;
+    uint64_t get_rounds = 0;
 };
 
 #define ASSERT_CHECK(stmt)      \
@@ -74,6 +78,7 @@ public:
 
     void do_bench(benchmark::State& state);
     void do_verify();
+    void do_get_bench(benchmark::State& state);
 
 private:
     PersistentIndexMetaPB _index_meta;
@@ -157,6 +162,35 @@ void PersistentIndexBenchTest::do_bench(benchmark::State& state) {
     do_verify();
 }
 
+void PersistentIndexBenchTest::do_get_bench(benchmark::State& state) {
+    if (_params.each_get_record == 0 || _params.get_rounds == 0) {
+        return;
+    }
+    vector<Key> keys(_params.each_get_record);
+    vector<Slice> key_slices(_params.each_get_record);
+    vector<IndexValue> get_values(_params.each_get_record);
+    std::mt19937_64 rng(_params.total_record);
+    std::uniform_int_distribution<uint64_t> dist(0, _params.total_record - 1);
+    uint64_t total_cost = 0;
+    uint64_t long_tail = 0;
+    for (uint64_t round = 0; round < _params.get_rounds; round++) {
+        for (int i = 0; i < _params.each_get_record; i++) {
+            keys[i] = "persistent_index_bench_" + std::to_string(dist(rng));
+            key_slices[i] = keys[i];
+        }
+        MonotonicStopWatch watch;
+        watch.start();
+        ASSERT_CHECK(_index->get(_params.each_get_record, key_slices.data(), get_values.data()));
+        uint64_t cost = watch.elapsed_time();
+        total_cost += cost;
+        long_tail = std::max(cost, long_tail);
+    }
+    double total_keys = static_cast<double>(_params.each_get_record * _params.get_rounds);
+    state.counters["get_keys_per_sec"] = benchmark::Counter(total_keys * 1e9 / std::max<uint64_t>(total_cost, 1));
+    LOG(INFO) << fmt::format("PersistentIndexBench get result, batch: {} avg_cost: {} long_tail_cost: {}",
+                             _params.each_get_record, total_cost / _params.get_rounds, long_tail);
+}
+
 static void bench_func(benchmark::State& state) {
     BenchParams params;
     params.key_size = 0;
@@ -167,7 +201,22 @@ static void bench_func(benchmark::State& state) {
     perf.do_bench(state);
 }
 
-static void process_args(benchmark::internal::Benchmark* b) {
+// measure batched random point lookups, which go through the per-shard (or per-page) probe of l1/l2 immutable index.
+static void bench_get_func(benchmark::State& state) {
+    BenchParams params;
+    params.key_size = 0;
+    params.total_record = state.range(0);
+    params.each_upsert_record = state.range(1);
+    params.each_get_record = state.range(2);
+    params.get_rounds = state.range(3);
+    config::enable_pindex_read_by_page = state.range(4) != 0;
+
+    PersistentIndexBenchTest perf(params);
+    perf.do_bench(state);
+    perf.do_get_bench(state);
+}
+
+static void set_bench_config() {
     config::l0_l1_merge_ratio = 10;
     config::l0_max_file_size = 209715200;
     config::l0_max_mem_usage = 67108864;
@@ -177,10 +226,21 @@ static void process_args(benchmark::internal::Benchmark* b) {
     config::enable_pindex_minor_compaction = true;
     config::max_allow_pindex_l2_num = 5;
     config::pindex_major_compaction_num_threads = 2;
+}
+
+static void process_args(benchmark::internal::Benchmark* b) {
+    set_bench_config();
     b->Args({10000000, 5000, 1})->Iterations(1);
 }
 
+static void process_get_args(benchmark::internal::Benchmark* b) {
+    set_bench_config();
+    b->Args({2000000, 50000, 4096, 100, 0})->Iterations(1);
+    b->Args({2000000, 50000, 4096, 100, 1})->Iterations(1);
+}
+
 BENCHMARK(bench_func)->Apply(process_args);
+BENCHMARK(bench_get_func)->Apply(process_get_args);
 
 } // namespace starrocks
 
@@ -30,6 +30,7 @@
 #include "util/hash_util.hpp"
 #include "util/mysql_row_buffer.h"
 #include "util/raw_container.h"
+#include "util/utf8.h"
 
 namespace starrocks {
 template <typename T>
@@ -58,6 +59,7 @@ template <typename T>
 void BinaryColumnBase<T>::append(const Column& src, size_t offset, size_t count) {
     DCHECK(offset + count <= src.size());
     const auto& b = down_cast<const BinaryColumnBase<T>&>(src);
+    const bool all_ascii = _known_ascii() && b._known_ascii();
 
     const unsigned char* p = &b._bytes[b._offsets[offset]];
     const unsigned char* e = &b._bytes[b._offsets[offset + count]];
@@ -80,6 +82,9 @@ void BinaryColumnBase<T>::append(const Column& src, size_t offset, size_t count)
     }
 
     _slices_cache = false;
+    if (all_ascii) {
+        _reset_ascii(true);
+    }
 }
 
 template <typename T>
@@ -91,6 +96,7 @@ void BinaryColumnBase<T>::append_selective(const Column& src, const uint32_t* in
     const auto& src_column = down_cast<const BinaryColumnBase<T>&>(src);
     const auto& src_offsets = src_column.get_offset();
     const auto& src_bytes = src_column.get_bytes();
+    const bool all_ascii = _known_ascii() && src_column._known_ascii();
 
     size_t cur_row_count = _offsets.size() - 1;
     size_t cur_byte_size = _bytes.size();
@@ -113,6 +119,9 @@ void BinaryColumnBase<T>::append_selective(const Column& src, const uint32_t* in
     }
 
     _slices_cache = false;
+    if (all_ascii) {
+        _reset_ascii(true);
+    }
 }
 
 template <typename T>
@@ -335,6 +344,19 @@ void BinaryColumnBase<T>::append_value_multiple_times(const void* value, size_t
     _slices_cache = false;
 }
 
+template <typename T>
+bool BinaryColumnBase<T>::is_ascii() const {
+    if (_ascii_checked_bytes > _bytes.size()) {
+        _reset_ascii();
+    }
+    if (!_has_non_ascii && _ascii_checked_bytes < _bytes.size()) {
+        const auto* data = reinterpret_cast<const char*>(_bytes.data());
+        _has_non_ascii = !validate_ascii_fast(data + _ascii_checked_bytes, _bytes.size() - _ascii_checked_bytes);
+        _ascii_checked_bytes = _bytes.size();
+    }
+    return !_has_non_ascii;
+}
+
 template <typename T>
 void BinaryColumnBase<T>::_build_slices() const {
     if constexpr (std::is_same_v<T, uint32_t>) {
@@ -387,6 +409,7 @@ void BinaryColumnBase<T>::update_rows(const Column& src, const uint32_t* indexes
     }
 
     if (!need_resize) {
+        const bool all_ascii = _known_ascii() && src_column._known_ascii();
         auto* dest_bytes = _bytes.data();
         const auto& src_bytes = src_column.get_bytes();
         const auto& src_offsets = src_column.get_offset();
@@ -394,6 +417,7 @@ void BinaryColumnBase<T>::update_rows(const Column& src, const uint32_t* indexes
             T str_size = src_offsets[i + 1] - src_offsets[i];
             strings::memcpy_inlined(dest_bytes + _offsets[indexes[i]], src_bytes.data() + src_offsets[i], str_size);
         }
+        _reset_ascii(all_ascii);
     } else {
         auto new_binary_column = BinaryColumnBase<T>::create();
         size_t idx_begin = 0;
@@ -414,6 +438,7 @@ void BinaryColumnBase<T>::update_rows(const Column& src, const uint32_t* indexes
 
 template <typename T>
 void BinaryColumnBase<T>::assign(size_t n, size_t idx) {
+    const bool all_ascii = _known_ascii();
     std::string value = std::string((char*)_bytes.data() + _offsets[idx], _offsets[idx + 1] - _offsets[idx]);
     _bytes.clear();
     _offsets.clear();
@@ -425,6 +450,7 @@ void BinaryColumnBase<T>::assign(size_t n, size_t idx) {
         _offsets.emplace_back(_bytes.size());
     }
     _slices_cache = false;
+    _reset_ascii(all_ascii);
 }
 
 //TODO(kks): improve this
@@ -433,11 +459,13 @@ void BinaryColumnBase<T>::remove_first_n_values(size_t count) {
     DCHECK_LE(count, _offsets.size() - 1);
     size_t remain_size = _offsets.size() - 1 - count;
 
+    const bool all_ascii = _known_ascii();
     ColumnPtr column = cut(count, remain_size);
     auto* binary_column = down_cast<const BinaryColumnBase<T>*>(column.get());
     _offsets = std::move(binary_column->_offsets);
     _bytes = std::move(binary_column->_bytes);
     _slices_cache = false;
+    _reset_ascii(all_ascii);
 }
 
 template <typename T>
@@ -462,6 +490,7 @@ ColumnPtr BinaryColumnBase<T>::cut(size_t start, size_t length) const {
     // copy value
     result->_bytes.resize(_offsets[upper] - _offsets[start]);
     strings::memcpy_inlined(result->_bytes.data(), _bytes.data() + _offsets[start], _offsets[upper] - _offsets[start]);
+    result->_reset_ascii(_known_ascii());
 
     return result;
 }
@@ -471,6 +500,8 @@ size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size
     auto start_offset = from;
     auto result_offset = from;
 
+    // the rows are compacted in place, so the checked prefix no longer covers the same bytes afterwards
+    const bool all_ascii = _known_ascii();
     uint8_t* data = _bytes.data();
 
 #ifdef __AVX2__
@@ -541,6 +572,7 @@ size_t BinaryColumnBase<T>::filter_range(const Filter& filter, size_t from, size
     }
 
     this->resize(result_offset);
+    _reset_ascii(all_ascii);
     return result_offset;
 }
 
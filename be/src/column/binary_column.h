@@ -62,11 +62,18 @@ public:
     }
 
     // NOTE: do *NOT* copy |_slices|
-    BinaryColumnBase(const BinaryColumnBase<T>& rhs) : _bytes(rhs._bytes), _offsets(rhs._offsets) {}
+    BinaryColumnBase(const BinaryColumnBase<T>& rhs)
+            : _bytes(rhs._bytes),
+              _offsets(rhs._offsets),
+              _ascii_checked_bytes(rhs._ascii_checked_bytes),
+              _has_non_ascii(rhs._has_non_ascii) {}
 
     // NOTE: do *NOT* copy |_slices|
     BinaryColumnBase(BinaryColumnBase<T>&& rhs) noexcept
-            : _bytes(std::move(rhs._bytes)), _offsets(std::move(rhs._offsets)) {}
+            : _bytes(std::move(rhs._bytes)),
+              _offsets(std::move(rhs._offsets)),
+              _ascii_checked_bytes(rhs._ascii_checked_bytes),
+              _has_non_ascii(rhs._has_non_ascii) {}
 
     BinaryColumnBase<T>& operator=(const BinaryColumnBase<T>& rhs) {
         BinaryColumnBase<T> tmp(rhs);
@@ -161,9 +168,11 @@ public:
     }
 
     void resize(size_t n) override {
+        const bool all_ascii = _known_ascii();
         _offsets.resize(n + 1, _offsets.back());
         _bytes.resize(_offsets.back());
         _slices_cache = false;
+        _reset_ascii(all_ascii);
     }
 
     void assign(size_t n, size_t idx) override;
@@ -300,7 +309,12 @@ public:
 
     const BinaryDataProxyContainer& get_proxy_data() const { return _immuable_container; }
 
-    Bytes& get_bytes() { return _bytes; }
+    // The bytes may be rewritten by the caller, so the cached ASCII property is dropped, even if the caller only
+    // reads them. Readers should use the const overload to keep the cache.
+    Bytes& get_bytes() {
+        _reset_ascii();
+        return _bytes;
+    }
 
     const Bytes& get_bytes() const { return _bytes; }
 
@@ -325,6 +339,8 @@ public:
         swap(_offsets, r._offsets);
         swap(_slices, r._slices);
         swap(_slices_cache, r._slices_cache);
+        swap(_ascii_checked_bytes, r._ascii_checked_bytes);
+        swap(_has_non_ascii, r._has_non_ascii);
     }
 
     void reset_column() override {
@@ -334,9 +350,19 @@ public:
         _offsets.resize(1, 0);
         _slices.clear();
         _slices_cache = false;
+        _reset_ascii();
+    }
+
+    void invalidate_slice_cache() {
+        _slices_cache = false;
+        _reset_ascii();
     }
 
-    void invalidate_slice_cache() { _slices_cache = false; }
+    // Returns whether all the strings are ASCII, so that string functions can take their byte-wise paths.
+    // The result is cached, and only the appended bytes are scanned when called again after appending.
+    // The writes through the non-const get_bytes() aren't tracked, so each call of it drops the cache, and a column
+    // fetched by the non-const ColumnHelper::get_binary_column() whose bytes are taken that way is scanned again.
+    bool is_ascii() const;
 
     std::string debug_item(size_t idx) const override;
 
@@ -361,11 +387,25 @@ public:
 private:
     void _build_slices() const;
 
+    // Whether all the bytes are known to be ASCII without scanning them.
+    bool _known_ascii() const { return !_has_non_ascii && _ascii_checked_bytes == _bytes.size(); }
+
+    // Drops the cached ASCII property after the bytes are rewritten, unless |all_ascii| tells the new bytes are
+    // still all ASCII, e.g. they are a part of bytes known to be ASCII.
+    void _reset_ascii(bool all_ascii = false) const {
+        _ascii_checked_bytes = all_ascii ? _bytes.size() : 0;
+        _has_non_ascii = false;
+    }
+
     Bytes _bytes;
     Offsets _offsets;
 
     mutable Container _slices;
     mutable bool _slices_cache = false;
+    // The first |_ascii_checked_bytes| bytes have been checked by is_ascii(), and |_has_non_ascii| tells
+    // whether there are non-ASCII bytes in them. Appending keeps the checked bytes, other changes reset them.
+    mutable size_t _ascii_checked_bytes = 0;
+    mutable bool _has_non_ascii = false;
     BinaryDataProxyContainer _immuable_container = BinaryDataProxyContainer(*this);
 };
 
@@ -607,6 +607,9 @@ CONF_Int64(compaction_memory_limit_per_worker, "2147483648"); // 2GB
 CONF_String(consistency_max_memory_limit, "10G");
 CONF_Int32(consistency_max_memory_limit_percent, "20");
 CONF_Int32(update_memory_limit_percent, "60");
+// Capacity of the row cache of primary key tables with row store, which is used by point lookups of short circuit
+// queries. 0 means disabled.
+CONF_Int64(pk_row_cache_capacity, "0");
 // Metadata cache limit for shared-nothing mode. Not working for PK table now.
 // Disable metadata cache when metadata_cache_memory_limit_percent <= 0.
 CONF_mInt32(metadata_cache_memory_limit_percent, "30"); // 30%
@@ -962,6 +965,11 @@ CONF_Int32(orc_loading_buffer_size, "8388608");
 // Refer to https://issues.apache.org/jira/browse/ORC-125 for more detailed information.
 CONF_mInt32(orc_writer_version, "-1");
 
+// parquet writer
+// The max number of threads to encode and compress the columns of a row group in parallel, including the sink thread.
+// The other threads come from the sink io thread pool. Set to 1 to encode all columns in the sink thread.
+CONF_mInt32(parquet_writer_column_encode_parallelism, "4");
+
 // parquet reader
 CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
@@ -978,6 +986,16 @@ CONF_Double(parquet_page_cache_decompress_threshold, "2.0");
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
+// Whether to derive the max coalesce distance of external table scans from the latency and bandwidth of the
+// storage instead of `io_coalesce_read_max_distance_size`, and to skip coalescing ranges that are in block cache.
+CONF_mBool(io_coalesce_cost_based_enable, "false");
+// Latency (in microseconds) and bandwidth (in MB/s) of a single read request, used by the cost based coalescing.
+CONF_mInt64(io_coalesce_local_latency_us, "100");
+CONF_mInt64(io_coalesce_local_bandwidth_mb, "1000");
+CONF_mInt64(io_coalesce_hdfs_latency_us, "2000");
+CONF_mInt64(io_coalesce_hdfs_bandwidth_mb, "200");
+CONF_mInt64(io_coalesce_object_store_latency_us, "20000");
+CONF_mInt64(io_coalesce_object_store_bandwidth_mb, "100");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
@@ -1039,6 +1057,9 @@ CONF_Int64(send_runtime_filter_via_http_rpc_min_size, "67108864");
 
 // -1: unlimited, 0: limit by memory use, >0: limit by queue_size
 CONF_mInt64(runtime_filter_queue_limit, "-1");
+// fan-out of the tree used to broadcast a merged global runtime filter to its consumers, each node of the
+// tree sends at most this number of RPCs. 0 means binomial tree(forward half of the remaining nodes each time).
+CONF_mInt64(runtime_filter_broadcast_tree_fanout, "0");
 
 CONF_Int64(rpc_connect_timeout_ms, "30000");
 
@@ -1105,6 +1126,17 @@ CONF_mInt32(starlet_filesystem_instance_cache_capacity, "10000");
 #endif
 
 CONF_mInt64(lake_metadata_cache_limit, /*2GB=*/"2147483648");
+// Max number of threads used to prefetch tablet metadata and delete vectors of the tablets about to be scanned
+// into metacache in background. 0 means disable prefetching.
+CONF_Int32(lake_metadata_prefetch_threads, "16");
+// Max number of pending prefetch tasks, tablets beyond the limit are loaded lazily on access.
+CONF_Int32(lake_metadata_prefetch_queue_size, "10240");
+// Whether to prefetch segment footers too, which costs more metacache memory.
+CONF_mBool(lake_metadata_prefetch_segment_footer, "false");
+// Whether to write the footers of all segments of a cloud native rowset into one segment meta bundle file, and
+// open the segments of a rowset with a single read of its bundle. The bundles are deleted along with their rowsets
+// only while it's enabled, the ones left after disabling it are removed by the orphan data file GC.
+CONF_mBool(lake_enable_segment_meta_bundle, "false");
 CONF_mBool(lake_print_delete_log, "false");
 CONF_mInt64(lake_compaction_stream_buffer_size_bytes, "1048576"); // 1MB
 // The interval to check whether lake compaction is valid. Set to <= 0 to disable the check.
@@ -1132,6 +1164,14 @@ CONF_mInt32(lake_pk_index_sst_max_compaction_versions, "100");
 // When the ratio of cumulative level to base level is greater than this config, use base merge.
 CONF_mDouble(lake_pk_index_cumulative_base_compaction_ratio, "0.1");
 CONF_Int32(lake_pk_index_block_cache_limit_percent, "10");
+// Number of threads used to read the sstable blocks of cloud native pk index concurrently when a batch of keys
+// misses in block cache. 0 means reading blocks one by one in the calling thread.
+CONF_Int32(lake_pk_index_sst_prefetch_threads, "8");
+// Number of threads used to merge key ranges of a large cloud native pk index major compaction concurrently,
+// 0 means merging sstables in one pass in the compaction thread.
+CONF_Int32(lake_pk_index_sst_compaction_threads, "4");
+// Size of input sstables covered by one key range in parallel pk index major compaction.
+CONF_mInt64(lake_pk_index_sst_compaction_range_bytes, "67108864");
 CONF_mBool(lake_clear_corrupted_cache, "true");
 // The maximum number of files which need to rebuilt in cloud native pk index.
 // If files which need to rebuilt larger than this, we will flush memtable immediately.
@@ -1353,6 +1393,12 @@ CONF_mInt32(pindex_rebuild_load_wait_seconds, "20");
 
 // Used by query cache, cache entries are evicted when it exceeds its capacity(500MB in default)
 CONF_Int64(query_cache_capacity, "536870912");
+// Capacity of the disk tier of query cache, cache entries evicted from memory are written to spill dirs
+// (spill_local_storage_dir) and promoted back to memory when they are hit again. 0 means disk tier is disabled.
+// The disk tier is not counted in the capacity of spill dirs used by query spilling.
+CONF_Int64(query_cache_disk_capacity, "0");
+// Max number of evicted cache entries waiting to be written to disk tier, entries are dropped when the queue is full.
+CONF_Int32(query_cache_disk_spill_queue_size, "64");
 
 // When query cache enabled, the operators in the drivers contains cache operator are multilane
 // operators, if the number of lanes is big, Fragment Instance would spend too much time to prepare
@@ -1360,6 +1406,12 @@ CONF_Int64(query_cache_capacity, "536870912");
 // ranges in [1,16], default value is 4.
 CONF_mInt32(query_cache_num_lanes_per_driver, "4");
 
+// When query cache enabled, the stale cache entry of a PRIMARY_KEYS tablet can be reused incrementally if the
+// delta versions only append new keys(i.e. neither rows of the rowsets covered by the cache entry are deleted or
+// updated, nor delta rowsets are produced by compaction), only the delta rowsets are scanned and merged with the
+// cached partial result.
+CONF_mBool(enable_query_cache_pk_incremental_refresh, "true");
+
 // Used by vector query cache, 500MB in default
 CONF_Int64(vector_query_cache_capacity, "536870912");
 
@@ -1450,6 +1502,11 @@ CONF_mBool(enable_drop_tablet_if_unfinished_txn, "true");
 CONF_Int32(lake_service_max_concurrency, "0");
 
 CONF_mInt64(lake_vacuum_min_batch_delete_size, "100");
+// Max number of threads shared by all vacuum requests to collect garbage files of tablets concurrently.
+CONF_Int32(lake_vacuum_tablet_thread_pool_num_max, "32");
+// Max number of tablets of a vacuum request that are processed concurrently, 1 means one by one. It also bounds the
+// memory of a request, since each tablet in process holds its own batch of files to delete.
+CONF_mInt32(lake_vacuum_tablet_parallelism, "8");
 
 // TOPN RuntimeFilter parameters
 CONF_mInt32(desc_hint_split_range, "10");
@@ -1513,6 +1570,21 @@ CONF_mBool(enable_light_pk_compaction_publish, "true");
 // if mem_limit < 16 GB, disable JIT.
 // else it = min(mem_limit*0.01, 1GB)
 CONF_mInt64(jit_lru_cache_size, "0");
+// the directory to persist the object code compiled by JIT, so that an expression compiled before, e.g. by the
+// repeated queries of a dashboard, is loaded instead of compiled again after BE restarts. Empty means disabled.
+CONF_String(jit_object_cache_dir, "");
+// the max number of object files persisted in jit_object_cache_dir, the oldest ones are evicted once it's reached.
+CONF_mInt64(jit_object_cache_max_files, "10000");
+
+// Whether to evaluate a deterministic function call repeated in the expressions of an operator, e.g. in both the
+// conjuncts and the projection, only once per chunk and share its result column.
+CONF_mBool(enable_sub_expr_cache, "true");
+
+// the capacity in bytes of the LRU cache of compiled hyperscan databases shared by LIKE / REGEXP predicates.
+CONF_Int64(hyperscan_database_cache_size, "67108864");
+// whether to evaluate a disjunction of LIKE / REGEXP predicates with constant patterns on one column
+// by a single multi-pattern hyperscan scan per row.
+CONF_mBool(enable_multi_pattern_like_predicate, "true");
 
 CONF_mInt64(arrow_io_coalesce_read_max_buffer_size, "8388608");
 CONF_mInt64(arrow_io_coalesce_read_max_distance_size, "1048576");
@@ -1529,6 +1601,15 @@ CONF_mBool(apply_del_vec_after_all_index_filter, "true");
 CONF_mDouble(connector_sink_mem_high_watermark_ratio, "0.3");
 CONF_mDouble(connector_sink_mem_low_watermark_ratio, "0.1");
 CONF_mDouble(connector_sink_mem_urgent_space_ratio, "0.1");
+// Whether a partitioned connector sink buffers the rows of new partitions, and spills them when the query enables
+// spill, once it has too many open file writers or runs short of memory, instead of closing writers early.
+CONF_mBool(enable_connector_sink_spill, "false");
+// The number of open file writers of a partitioned connector sink above which the rows of partitions without an open
+// writer are buffered.
+CONF_mInt32(connector_sink_spill_max_open_writers, "32");
+// The bytes of rows a partitioned connector sink buffers in memory before writing out or spilling the largest
+// buffered partition.
+CONF_mInt64(connector_sink_spill_buffer_bytes, "268435456");
 
 // .crm file can be removed after 1day.
 CONF_mInt32(unused_crm_file_threshold_second, "86400" /** 1day **/);
@@ -1645,6 +1726,8 @@ CONF_mInt32(avro_reader_buffer_size_bytes, "8388608");
 CONF_mInt32(json_parse_many_batch_size, "1000000");
 CONF_mBool(enable_dynamic_batch_size_for_json_parse_many, "true");
 CONF_mInt32(put_combined_txn_log_thread_pool_num_max, "64");
+// Max number of threads used to load the txn logs of a lake batch publish concurrently.
+CONF_Int32(load_txn_log_thread_pool_num_max, "32");
 CONF_mBool(enable_put_combinded_txn_log_parallel, "false");
 // used to control whether the metrics/ interface collects table metrics
 CONF_mBool(enable_collect_table_metrics, "true");
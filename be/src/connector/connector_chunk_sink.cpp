@@ -15,8 +15,11 @@
 #include "connector_chunk_sink.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "connector/sink_memory_manager.h"
+#include "connector/spillable_partition_buffer.h"
+#include "exec/pipeline/query_context.h"
 #include "formats/file_writer.h"
 #include "runtime/runtime_state.h"
 
@@ -35,15 +38,23 @@ ConnectorChunkSink::ConnectorChunkSink(std::vector<std::string> partition_column
           _state(state),
           _support_null_partition(support_null_partition) {}
 
+ConnectorChunkSink::~ConnectorChunkSink() = default;
+
 Status ConnectorChunkSink::init() {
     RETURN_IF_ERROR(ColumnEvaluator::init(_partition_column_evaluators));
     RETURN_IF_ERROR(_file_writer_factory->init());
+    if (!_partition_column_names.empty() && config::enable_connector_sink_spill && _state->enable_spill() &&
+        _state->query_ctx() != nullptr && _state->query_ctx()->spill_manager() != nullptr) {
+        _partition_buffer = std::make_unique<SpillablePartitionBuffer>(
+                _state, _state->query_ctx()->spill_manager()->block_manager(), _profile);
+    }
     _op_mem_mgr->init(&_writer_stream_pairs, _io_poller,
-                      [this](const CommitResult& r) { this->callback_on_commit(r); });
+                      [this](const CommitResult& r) { this->callback_on_commit(r); }, _partition_buffer.get());
     return Status::OK();
 }
 
 Status ConnectorChunkSink::add(Chunk* chunk) {
+    RETURN_IF_ERROR(task_status());
     std::string partition = DEFAULT_PARTITION;
     bool partitioned = !_partition_column_names.empty();
     if (partitioned) {
@@ -52,41 +63,124 @@ Status ConnectorChunkSink::add(Chunk* chunk) {
                                                         _support_null_partition));
     }
 
+    if (_should_buffer(partition)) {
+        ASSIGN_OR_RETURN(bool buffered, _partition_buffer->append(partition, *chunk));
+        if (buffered) {
+            return _evict_buffered_partition_if_needed();
+        }
+    }
+    return _write_partition_chunk(partition, chunk);
+}
+
+bool ConnectorChunkSink::_should_buffer(const std::string& partition) const {
+    if (_partition_buffer == nullptr || _partition_buffer->spill_failed()) {
+        return false;
+    }
+    if (_partition_buffer->contains(partition)) {
+        return true;
+    }
+    if (_writer_stream_pairs.contains(partition)) {
+        return false;
+    }
+    return static_cast<int64_t>(_writer_stream_pairs.size()) >= config::connector_sink_spill_max_open_writers ||
+           _op_mem_mgr->under_memory_pressure();
+}
+
+Status ConnectorChunkSink::_evict_buffered_partition_if_needed() {
+    if (_partition_buffer->buffered_bytes() <= config::connector_sink_spill_buffer_bytes) {
+        return Status::OK();
+    }
+    auto partition = _partition_buffer->largest_partition();
+    if (partition.empty()) {
+        return Status::OK();
+    }
+    if (_partition_buffer->spill_failed()) {
+        // the close-writer path, the file is closed once the rows are written
+        return _write_buffered_partition_async(std::move(partition), true);
+    }
+    // write the rows out directly if it takes no more writer than allowed, it's cheaper than spilling them
+    if (_writer_stream_pairs.contains(partition) ||
+        (static_cast<int64_t>(_writer_stream_pairs.size()) < config::connector_sink_spill_max_open_writers &&
+         !_op_mem_mgr->under_memory_pressure())) {
+        return _write_buffered_partition_async(std::move(partition), false);
+    }
+    auto st = _partition_buffer->spill_async(partition);
+    if (!st.ok()) {
+        LOG(WARNING) << "spill partition buffer failed: " << st;
+        return _write_buffered_partition_async(std::move(partition), true);
+    }
+    return Status::OK();
+}
+
+Status ConnectorChunkSink::_write_buffered_partition_async(std::string partition, bool commit) {
+    return _partition_buffer->submit_task(
+            [this, partition = std::move(partition), commit]() { return _write_buffered_partition(partition, commit); });
+}
+
+Status ConnectorChunkSink::_write_buffered_partition(const std::string& partition, bool commit) {
+    RETURN_IF_ERROR(_partition_buffer->drain(
+            partition, [&](Chunk* chunk) { return _write_partition_chunk(partition, chunk); }));
+    auto it = _writer_stream_pairs.find(partition);
+    if (commit && it != _writer_stream_pairs.end()) {
+        callback_on_commit(it->second.first->commit());
+        _writer_stream_pairs.erase(it);
+    }
+    return Status::OK();
+}
+
+Status ConnectorChunkSink::_write_partition_chunk(const std::string& partition, Chunk* chunk) {
     auto it = _writer_stream_pairs.find(partition);
     if (it != _writer_stream_pairs.end()) {
         Writer* writer = it->second.first.get();
-        if (writer->get_written_bytes() >= _max_file_size) {
-            callback_on_commit(writer->commit());
-            _writer_stream_pairs.erase(it);
-            auto path = partitioned ? _location_provider->get(partition) : _location_provider->get();
-            ASSIGN_OR_RETURN(auto new_writer_and_stream, _file_writer_factory->create(path));
-            std::unique_ptr<Writer> new_writer = std::move(new_writer_and_stream.writer);
-            std::unique_ptr<Stream> new_stream = std::move(new_writer_and_stream.stream);
-            RETURN_IF_ERROR(new_writer->init());
-            RETURN_IF_ERROR(new_writer->write(chunk));
-            _writer_stream_pairs[partition] = std::make_pair(std::move(new_writer), new_stream.get());
-            _io_poller->enqueue(std::move(new_stream));
-        } else {
-            RETURN_IF_ERROR(writer->write(chunk));
+        if (writer->get_written_bytes() < _max_file_size) {
+            return writer->write(chunk);
         }
-    } else {
-        auto path = partitioned ? _location_provider->get(partition) : _location_provider->get();
-        ASSIGN_OR_RETURN(auto new_writer_and_stream, _file_writer_factory->create(path));
-        std::unique_ptr<Writer> new_writer = std::move(new_writer_and_stream.writer);
-        std::unique_ptr<Stream> new_stream = std::move(new_writer_and_stream.stream);
-        RETURN_IF_ERROR(new_writer->init());
-        RETURN_IF_ERROR(new_writer->write(chunk));
-        _writer_stream_pairs[partition] = std::make_pair(std::move(new_writer), new_stream.get());
-        _io_poller->enqueue(std::move(new_stream));
+        callback_on_commit(writer->commit());
+        _writer_stream_pairs.erase(it);
     }
+
+    auto path = _partition_column_names.empty() ? _location_provider->get() : _location_provider->get(partition);
+    ASSIGN_OR_RETURN(auto new_writer_and_stream, _file_writer_factory->create(path));
+    std::unique_ptr<Writer> new_writer = std::move(new_writer_and_stream.writer);
+    std::unique_ptr<Stream> new_stream = std::move(new_writer_and_stream.stream);
+    RETURN_IF_ERROR(new_writer->init());
+    RETURN_IF_ERROR(new_writer->write(chunk));
+    _writer_stream_pairs[partition] = std::make_pair(std::move(new_writer), new_stream.get());
+    _io_poller->enqueue(std::move(new_stream));
     return Status::OK();
 }
 
 Status ConnectorChunkSink::finish() {
+    DCHECK(!has_pending_task());
+    // nothing is committed once an io task failed
+    RETURN_IF_ERROR(task_status());
+    if (_partition_buffer != nullptr && !_partition_buffer->partitions().empty()) {
+        // write out the buffered partitions one after another and close the file of each partition before moving
+        // on, so that at most one more file writer is open at a time
+        return _partition_buffer->submit_task([this]() {
+            for (const auto& partition : _partition_buffer->partitions()) {
+                RETURN_IF_ERROR(_write_buffered_partition(partition, true));
+            }
+            _commit_all();
+            return Status::OK();
+        });
+    }
+    _commit_all();
+    return Status::OK();
+}
+
+void ConnectorChunkSink::_commit_all() {
     for (auto& [_, writer_and_stream] : _writer_stream_pairs) {
         callback_on_commit(writer_and_stream.first->commit());
     }
-    return Status::OK();
+}
+
+bool ConnectorChunkSink::has_pending_task() const {
+    return _partition_buffer != nullptr && _partition_buffer->has_pending_task();
+}
+
+Status ConnectorChunkSink::task_status() const {
+    return _partition_buffer != nullptr ? _partition_buffer->task_status() : Status::OK();
 }
 
 void ConnectorChunkSink::rollback() {
@@ -27,6 +27,7 @@ namespace starrocks::connector {
 
 class AsyncFlushStreamPoller;
 class SinkOperatorMemoryManager;
+class SpillablePartitionBuffer;
 
 using Writer = formats::FileWriter;
 using Stream = io::AsyncFlushOutputStream;
@@ -46,21 +47,49 @@ public:
 
     void set_operator_mem_mgr(SinkOperatorMemoryManager* op_mem_mgr) { _op_mem_mgr = op_mem_mgr; }
 
-    virtual ~ConnectorChunkSink() = default;
+    void set_profile(RuntimeProfile* profile) { _profile = profile; }
+
+    virtual ~ConnectorChunkSink();
 
     Status init();
 
     Status add(Chunk* chunk);
 
+    // Commits all files, after writing out the buffered partitions in an io task if any, see has_pending_task().
     Status finish();
 
     void rollback();
 
+    // Returns true if an io task of the partition buffer is running, the sink must not be touched until it's done.
+    bool has_pending_task() const;
+
+    // The first error of the io tasks of the partition buffer.
+    Status task_status() const;
+
     virtual void callback_on_commit(const CommitResult& result) = 0;
 
 protected:
+    // write |chunk| to the file writer of |partition|, a new file is started once the current one is large enough
+    Status _write_partition_chunk(const std::string& partition, Chunk* chunk);
+
+    // The rows of a partition are buffered only if the partition has no open writer, and the sink has too many open
+    // writers or runs short of memory. Nothing more is buffered once a spill fails.
+    bool _should_buffer(const std::string& partition) const;
+
+    // Once the buffer is full, writes out the largest buffered partition if it has an open writer or a new writer
+    // can be opened, spills it otherwise.
+    Status _evict_buffered_partition_if_needed();
+
+    Status _write_buffered_partition_async(std::string partition, bool commit);
+
+    // write out the buffered rows of |partition| and close its file if |commit| is true
+    Status _write_buffered_partition(const std::string& partition, bool commit);
+
+    void _commit_all();
+
     AsyncFlushStreamPoller* _io_poller = nullptr;
     SinkOperatorMemoryManager* _op_mem_mgr = nullptr;
+    RuntimeProfile* _profile = nullptr;
 
     std::vector<std::string> _partition_column_names;
     std::vector<std::unique_ptr<ColumnEvaluator>> _partition_column_evaluators;
@@ -72,6 +101,8 @@ protected:
     std::vector<std::function<void()>> _rollback_actions;
 
     std::unordered_map<std::string, WriterStreamPair> _writer_stream_pairs;
+    // buffers the rows of a partitioned sink by partition when the query enables spill, see SpillablePartitionBuffer
+    std::unique_ptr<SpillablePartitionBuffer> _partition_buffer;
     inline static std::string DEFAULT_PARTITION = "__DEFAULT_PARTITION__";
 };
 
@@ -508,6 +508,10 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
         _profile.shared_buffered_direct_io_count =
                 ADD_CHILD_COUNTER(_runtime_profile, "DirectIOCount", TUnit::UNIT, prefix);
         _profile.shared_buffered_direct_io_timer = ADD_CHILD_TIMER(_runtime_profile, "DirectIOTime", prefix);
+        _profile.shared_buffered_skip_cached_io_count =
+                ADD_CHILD_COUNTER(_runtime_profile, "SkipCachedIOCount", TUnit::UNIT, prefix);
+        _profile.shared_buffered_skip_cached_io_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "SkipCachedIOBytes", TUnit::BYTES, prefix);
     }
 
     if (_datacache_options.enable_datacache) {
@@ -22,7 +22,9 @@
 #include "exec/pipeline/fragment_context.h"
 #include "runtime/global_dict/parser.h"
 #include "storage/column_predicate_rewriter.h"
+#include "storage/lake/metadata_prefetcher.h"
 #include "storage/lake/tablet.h"
+#include "storage/lake/tablet_manager.h"
 #include "storage/predicate_parser.h"
 #include "storage/predicate_tree/predicate_tree.hpp"
 #include "storage/projection_iterator.h"
@@ -814,6 +816,8 @@ StatusOr<pipeline::MorselQueuePtr> LakeDataSourceProvider::convert_scan_range_to
         const std::vector<TScanRangeParams>& scan_ranges, int node_id, int32_t pipeline_dop,
         bool enable_tablet_internal_parallel, TTabletInternalParallelMode::type tablet_internal_parallel_mode,
         size_t num_total_scan_ranges, size_t scan_parallelism) {
+    _prefetch_tablet_metadata(scan_ranges);
+
     int64_t lake_scan_parallelism = 0;
     if (!scan_ranges.empty() && enable_tablet_internal_parallel) {
         ASSIGN_OR_RETURN(_could_split, _could_tablet_internal_parallel(scan_ranges, pipeline_dop, num_total_scan_ranges,
@@ -829,6 +833,31 @@ StatusOr<pipeline::MorselQueuePtr> LakeDataSourceProvider::convert_scan_range_to
             num_total_scan_ranges, (size_t)lake_scan_parallelism);
 }
 
+void LakeDataSourceProvider::_prefetch_tablet_metadata(const std::vector<TScanRangeParams>& scan_ranges) const {
+    // A single tablet is loaded on open without extra latency, only prefetch when there are many tablets to scan.
+    if (scan_ranges.size() <= 1) {
+        return;
+    }
+#ifdef BE_TEST
+    auto tablet_mgr = _tablet_manager;
+#else
+    auto tablet_mgr = ExecEnv::GetInstance()->lake_tablet_manager();
+#endif
+    if (tablet_mgr == nullptr || tablet_mgr->metadata_prefetcher() == nullptr) {
+        return;
+    }
+    std::vector<std::pair<int64_t, int64_t>> tablet_versions;
+    tablet_versions.reserve(scan_ranges.size());
+    for (const auto& scan_range : scan_ranges) {
+        if (!scan_range.scan_range.__isset.internal_scan_range) {
+            continue;
+        }
+        const auto& internal_scan_range = scan_range.scan_range.internal_scan_range;
+        tablet_versions.emplace_back(internal_scan_range.tablet_id, std::stoll(internal_scan_range.version));
+    }
+    tablet_mgr->metadata_prefetcher()->prefetch(tablet_versions);
+}
+
 StatusOr<bool> LakeDataSourceProvider::_could_tablet_internal_parallel(
         const std::vector<TScanRangeParams>& scan_ranges, int32_t pipeline_dop, size_t num_total_scan_ranges,
         TTabletInternalParallelMode::type tablet_internal_parallel_mode, int64_t* scan_parallelism,
@@ -240,13 +240,15 @@ protected:
     const TLakeScanNode _t_lake_scan_node;
 
     // for ut
-    lake::TabletManager* _tablet_manager;
+    lake::TabletManager* _tablet_manager = nullptr;
 
     bool _could_split = false;
     bool _could_split_physically = false;
     int64_t splitted_scan_rows = 0;
 
 private:
+    // Load tablet metadata and delvecs of the tablets to scan into metacache in background.
+    void _prefetch_tablet_metadata(const std::vector<TScanRangeParams>& scan_ranges) const;
     StatusOr<bool> _could_tablet_internal_parallel(const std::vector<TScanRangeParams>& scan_ranges,
                                                    int32_t pipeline_dop, size_t num_total_scan_ranges,
                                                    TTabletInternalParallelMode::type tablet_internal_parallel_mode,
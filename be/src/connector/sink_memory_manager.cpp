@@ -14,18 +14,38 @@
 
 #include "connector/sink_memory_manager.h"
 
+#include "connector/spillable_partition_buffer.h"
 #include "runtime/exec_env.h"
 
 namespace starrocks::connector {
 
 void SinkOperatorMemoryManager::init(std::unordered_map<std::string, WriterStreamPair>* writer_stream_pairs,
-                                     AsyncFlushStreamPoller* io_poller, CommitFunc commit_func) {
+                                     AsyncFlushStreamPoller* io_poller, CommitFunc commit_func,
+                                     SpillablePartitionBuffer* partition_buffer) {
     _candidates = writer_stream_pairs;
     _commit_func = std::move(commit_func);
     _io_poller = io_poller;
+    _partition_buffer = partition_buffer;
 }
 
 bool SinkOperatorMemoryManager::kill_victim() {
+    if (_partition_buffer != nullptr) {
+        if (_partition_buffer->has_pending_task()) {
+            // the io task may use the writers, the memory is released once it's done
+            return false;
+        }
+        auto partition = _partition_buffer->largest_partition();
+        if (!partition.empty() && !_partition_buffer->spill_failed()) {
+            // spilling the buffered rows does not produce small files, prefer it to closing writers early
+            auto st = _partition_buffer->spill_async(partition);
+            if (st.ok()) {
+                return true;
+            }
+            // fall back to closing writers
+            LOG(WARNING) << "spill partition buffer failed: " << st;
+        }
+    }
+
     if (_candidates->empty()) {
         return false;
     }
@@ -53,6 +73,9 @@ bool SinkOperatorMemoryManager::kill_victim() {
 
 int64_t SinkOperatorMemoryManager::update_releasable_memory() {
     int64_t releasable_memory = _io_poller->releasable_memory();
+    if (_partition_buffer != nullptr) {
+        releasable_memory += _partition_buffer->spilling_bytes();
+    }
     _releasable_memory.store(releasable_memory);
     return releasable_memory;
 }
@@ -62,6 +85,9 @@ int64_t SinkOperatorMemoryManager::update_writer_occupied_memory() {
     for (auto& [_, writer_and_stream] : *_candidates) {
         writer_occupied_memory += writer_and_stream.first->get_written_bytes();
     }
+    if (_partition_buffer != nullptr) {
+        writer_occupied_memory += _partition_buffer->buffered_bytes() - _partition_buffer->spilling_bytes();
+    }
     _writer_occupied_memory.store(writer_occupied_memory);
     return _writer_occupied_memory;
 }
@@ -82,6 +108,7 @@ SinkOperatorMemoryManager* SinkMemoryManager::create_child_manager() {
 }
 
 bool SinkMemoryManager::can_accept_more_input(SinkOperatorMemoryManager* child_manager) {
+    child_manager->set_under_memory_pressure(false);
     if (!_apply_on_mem_tracker(child_manager, _process_tracker)) {
         return false;
     }
@@ -119,6 +146,7 @@ bool SinkMemoryManager::_apply_on_mem_tracker(SinkOperatorMemoryManager* child_m
     };
 
     if (available_memory() <= low_watermark) {
+        child_manager->set_under_memory_pressure(true);
         child_manager->update_releasable_memory();
         child_manager->update_writer_occupied_memory();
         LOG_EVERY_SECOND(WARNING) << "consumption: " << mem_tracker->consumption()
@@ -29,11 +29,17 @@ public:
     SinkOperatorMemoryManager() = default;
 
     void init(std::unordered_map<std::string, WriterStreamPair>* writer_stream_pairs, AsyncFlushStreamPoller* io_poller,
-              CommitFunc commit_func);
+              CommitFunc commit_func, SpillablePartitionBuffer* partition_buffer = nullptr);
 
-    // return true if a victim is found and killed, otherwise return false
+    // return true if a victim is found and killed, or the spill of the largest buffered partition is started,
+    // otherwise return false
     bool kill_victim();
 
+    // whether the available memory was below the low watermark when the sink operator asked for more input last time
+    bool under_memory_pressure() const { return _under_memory_pressure; }
+
+    void set_under_memory_pressure(bool under_memory_pressure) { _under_memory_pressure = under_memory_pressure; }
+
     int64_t update_releasable_memory();
 
     int64_t update_writer_occupied_memory();
@@ -48,8 +54,10 @@ private:
     std::unordered_map<std::string, WriterStreamPair>* _candidates = nullptr; // reference, owned by sink operator
     CommitFunc _commit_func;
     AsyncFlushStreamPoller* _io_poller;
+    SpillablePartitionBuffer* _partition_buffer = nullptr; // reference, owned by sink operator
     std::atomic_int64_t _releasable_memory{0};
     std::atomic_int64_t _writer_occupied_memory{0};
+    bool _under_memory_pressure = false;
 };
 
 /// 1. manage all sink operators in a query
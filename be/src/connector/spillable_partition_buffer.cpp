@@ -0,0 +1,233 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connector/spillable_partition_buffer.h"
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "exec/pipeline/fragment_context.h"
+#include "exec/spill/data_stream.h"
+#include "exec/spill/executor.h"
+#include "exec/spill/options.h"
+#include "exec/spill/serde.h"
+#include "exec/spill/spiller.h"
+#include "runtime/current_thread.h"
+#include "runtime/runtime_state.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks::connector {
+
+SpillablePartitionBuffer::SpillablePartitionBuffer(RuntimeState* state, spill::BlockManager* block_manager,
+                                                   RuntimeProfile* profile)
+        : _state(state), _block_manager(block_manager), _profile(profile) {
+    if (_profile == nullptr) {
+        _dummy_profile = std::make_unique<RuntimeProfile>("SpillablePartitionBuffer");
+        _profile = _dummy_profile.get();
+    }
+    if (_state->fragment_ctx() != nullptr) {
+        _wg = _state->fragment_ctx()->workgroup();
+    }
+    _spiller_factory = spill::make_spilled_factory();
+}
+
+SpillablePartitionBuffer::~SpillablePartitionBuffer() {
+    DCHECK(!has_pending_task());
+    // release the spilled blocks before the spiller
+    _partitions.clear();
+}
+
+StatusOr<bool> SpillablePartitionBuffer::append(const std::string& partition, const Chunk& chunk) {
+    DCHECK(!has_pending_task());
+    if (chunk.is_empty()) {
+        return true;
+    }
+
+    // unfold the const columns and make all columns nullable, so that the chunks can be spilled with one schema
+    // whatever the nullability of their columns
+    ChunkPtr copy = chunk.clone_unique();
+    for (size_t i = 0; i < copy->num_columns(); i++) {
+        auto column = ColumnHelper::unpack_and_duplicate_const_column(copy->num_rows(), copy->get_column_by_index(i));
+        copy->update_column_by_index(ColumnHelper::cast_to_nullable_column(std::move(column)), i);
+    }
+    if (_column_names.empty()) {
+        for (const auto& column : copy->columns()) {
+            _column_names.emplace_back(column->get_name());
+        }
+    } else {
+        if (copy->num_columns() != _column_names.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < copy->num_columns(); i++) {
+            if (copy->get_column_by_index(i)->get_name() != _column_names[i]) {
+                return false;
+            }
+        }
+    }
+
+    auto& data = _partitions[partition];
+    int64_t bytes = copy->memory_usage();
+    data.chunks.emplace_back(std::move(copy));
+    data.buffered_bytes += bytes;
+    _buffered_bytes += bytes;
+    return true;
+}
+
+std::string SpillablePartitionBuffer::largest_partition() const {
+    const std::string* victim = nullptr;
+    int64_t victim_bytes = 0;
+    for (const auto& [partition, data] : _partitions) {
+        if (data.buffered_bytes > victim_bytes) {
+            victim = &partition;
+            victim_bytes = data.buffered_bytes;
+        }
+    }
+    return victim != nullptr ? *victim : std::string();
+}
+
+Status SpillablePartitionBuffer::spill_async(const std::string& partition) {
+    auto it = _partitions.find(partition);
+    if (it == _partitions.end() || it->second.buffered_bytes == 0) {
+        return Status::OK();
+    }
+    PartitionData* data = &it->second;
+    _spilling_bytes = data->buffered_bytes;
+    auto st = submit_task([this, data]() {
+        auto st = _spill(data);
+        _spilling_bytes = 0;
+        if (!st.ok()) {
+            // keep the rows in memory, the sink writes them out instead
+            LOG(WARNING) << "spill partition buffer failed: " << st;
+            _spill_failed.store(true, std::memory_order_release);
+        }
+        return Status::OK();
+    });
+    if (!st.ok()) {
+        _spilling_bytes = 0;
+        _spill_failed.store(true, std::memory_order_release);
+    }
+    return st;
+}
+
+std::vector<std::string> SpillablePartitionBuffer::partitions() const {
+    std::vector<std::string> partitions;
+    partitions.reserve(_partitions.size());
+    for (const auto& [partition, _] : _partitions) {
+        partitions.emplace_back(partition);
+    }
+    return partitions;
+}
+
+Status SpillablePartitionBuffer::drain(const std::string& partition, const ChunkConsumer& consumer) {
+    auto it = _partitions.find(partition);
+    if (it == _partitions.end()) {
+        return Status::OK();
+    }
+    auto& data = it->second;
+    if (!data.block_group.blocks().empty()) {
+        const auto& metrics = _spiller->metrics();
+        spill::BlockReaderOptions options;
+        options.read_io_timer = metrics.read_io_timer;
+        options.read_io_count = metrics.read_io_count;
+        options.read_io_bytes = metrics.restore_bytes;
+        spill::SerdeContext ctx;
+        for (const auto& block : data.block_group.blocks()) {
+            auto reader = block->get_reader(options);
+            while (true) {
+                auto chunk_or = _spiller->serde()->deserialize(ctx, reader.get());
+                if (chunk_or.status().is_end_of_file()) {
+                    break;
+                }
+                RETURN_IF_ERROR(chunk_or.status());
+                RETURN_IF_ERROR(consumer(chunk_or.value().get()));
+            }
+        }
+    }
+    for (const auto& chunk : data.chunks) {
+        RETURN_IF_ERROR(consumer(chunk.get()));
+    }
+    _buffered_bytes -= data.buffered_bytes;
+    _partitions.erase(it);
+    return Status::OK();
+}
+
+Status SpillablePartitionBuffer::submit_task(Task task) {
+    DCHECK(!has_pending_task());
+    _pending_task.store(true, std::memory_order_release);
+    auto work = [this, task = std::move(task)](workgroup::YieldContext& yield_ctx) {
+        auto yield_defer = yield_ctx.defer_finished();
+        {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_state->instance_mem_tracker());
+            auto st = task();
+            if (!st.ok()) {
+                std::lock_guard l(_task_status_lock);
+                _task_status.update(st);
+            }
+        }
+        // the sink may be closed once the task is done, don't touch it afterwards
+        _pending_task.store(false, std::memory_order_release);
+    };
+    // the task never yields
+    auto io_task = workgroup::ScanTask(_wg, std::move(work));
+    auto st = _wg != nullptr ? spill::IOTaskExecutor::submit(std::move(io_task))
+                             : spill::SyncTaskExecutor::submit(std::move(io_task));
+    if (!st.ok()) {
+        _pending_task.store(false, std::memory_order_release);
+    }
+    return st;
+}
+
+Status SpillablePartitionBuffer::task_status() const {
+    std::lock_guard l(_task_status_lock);
+    return _task_status;
+}
+
+Status SpillablePartitionBuffer::_prepare_spiller(const ChunkPtr& chunk) {
+    spill::SpilledOptions options;
+    options.name = "connector-sink-spill";
+    options.encode_level = _state->spill_encode_level();
+    options.block_manager = _block_manager;
+    options.wg = _wg;
+    _spiller = _spiller_factory->create(options);
+    RETURN_IF_ERROR(_spiller->prepare(_state));
+    _spiller->set_metrics(spill::SpillProcessMetrics(_profile, _state->mutable_total_spill_bytes()));
+    const_cast<spill::ChunkBuilder*>(&_spiller->chunk_builder())->chunk_schema()->set_schema(chunk);
+    return _spiller->serde()->prepare();
+}
+
+Status SpillablePartitionBuffer::_spill(PartitionData* data) {
+    if (_spiller == nullptr) {
+        RETURN_IF_ERROR(_prepare_spiller(data->chunks.front()));
+    }
+    // write into a new block group, so that nothing is left in the partition if the spill fails
+    spill::BlockGroup block_group;
+    auto output = spill::create_spill_output_stream(_spiller.get(), &block_group, _block_manager);
+    spill::SerdeContext ctx;
+    const bool aligned = _state->spill_enable_direct_io();
+    for (const auto& chunk : data->chunks) {
+        RETURN_IF_ERROR(_spiller->serde()->serialize(_state, ctx, chunk, output, aligned));
+        COUNTER_UPDATE(_spiller->metrics().spill_rows, chunk->num_rows());
+    }
+    RETURN_IF_ERROR(output->flush());
+
+    for (const auto& block : block_group.blocks()) {
+        data->block_group.append(block);
+    }
+    _spilled_bytes += data->buffered_bytes;
+    _buffered_bytes -= data->buffered_bytes;
+    data->buffered_bytes = 0;
+    data->chunks.clear();
+    return Status::OK();
+}
+
+} // namespace starrocks::connector
@@ -0,0 +1,131 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/status.h"
+#include "common/statusor.h"
+#include "exec/spill/input_stream.h"
+#include "exec/spill/spiller_factory.h"
+#include "exec/workgroup/work_group_fwd.h"
+
+namespace starrocks {
+class RuntimeProfile;
+class RuntimeState;
+} // namespace starrocks
+
+namespace starrocks::spill {
+class BlockManager;
+class Spiller;
+} // namespace starrocks::spill
+
+namespace starrocks::connector {
+
+// Buffers the rows of a partitioned connector sink by partition instead of writing them to a file writer per
+// partition, used once the sink has too many open writers or runs short of memory. The buffered rows of a partition
+// are either written out by the sink, or serialized into blocks of |block_manager| to release memory. Once all input
+// is received, the sink drains the partitions one after another, so that only one file writer is open at a time and
+// every file is filled up to the target file size.
+//
+// Spilling and draining run as io tasks on the spill io executor of the query. At most one task runs at a time, and
+// the sink must not touch the buffer or its own file writers while a task is pending.
+// not thread-safe
+class SpillablePartitionBuffer {
+public:
+    using ChunkConsumer = std::function<Status(Chunk* chunk)>;
+    using Task = std::function<Status()>;
+
+    SpillablePartitionBuffer(RuntimeState* state, spill::BlockManager* block_manager, RuntimeProfile* profile);
+
+    ~SpillablePartitionBuffer();
+
+    // Buffers a copy of |chunk| for |partition|.
+    // Returns false if the columns of |chunk| differ in type from the columns buffered so far (e.g. a const null
+    // column), and the caller should write it out directly.
+    StatusOr<bool> append(const std::string& partition, const Chunk& chunk);
+
+    bool contains(const std::string& partition) const { return _partitions.contains(partition); }
+
+    // Returns the partition which buffers the most bytes in memory, or an empty string if nothing is buffered.
+    std::string largest_partition() const;
+
+    // Starts an io task which spills the rows of |partition| buffered in memory. If the spill fails, the rows are
+    // kept in memory and spill_failed() returns true, so that the sink falls back to writing them out.
+    Status spill_async(const std::string& partition);
+
+    bool spill_failed() const { return _spill_failed.load(std::memory_order_acquire); }
+
+    std::vector<std::string> partitions() const;
+
+    // Passes all rows of |partition| to |consumer|, spilled rows first, then releases them.
+    Status drain(const std::string& partition, const ChunkConsumer& consumer);
+
+    // Runs |task| on the spill io executor, or in place if the query has no workgroup.
+    Status submit_task(Task task);
+
+    bool has_pending_task() const { return _pending_task.load(std::memory_order_acquire); }
+
+    // The first error of the io tasks.
+    Status task_status() const;
+
+    // bytes of the rows buffered in memory, including the ones being spilled
+    int64_t buffered_bytes() const { return _buffered_bytes.load(std::memory_order_relaxed); }
+
+    // bytes of the rows being spilled, which are released once the spill finishes
+    int64_t spilling_bytes() const { return _spilling_bytes.load(std::memory_order_relaxed); }
+
+    int64_t spilled_bytes() const { return _spilled_bytes.load(std::memory_order_relaxed); }
+
+private:
+    struct PartitionData {
+        std::vector<ChunkPtr> chunks;
+        int64_t buffered_bytes = 0;
+        spill::BlockGroup block_group;
+    };
+
+    Status _prepare_spiller(const ChunkPtr& chunk);
+
+    Status _spill(PartitionData* data);
+
+    RuntimeState* _state;
+    spill::BlockManager* _block_manager;
+    RuntimeProfile* _profile;
+    std::unique_ptr<RuntimeProfile> _dummy_profile;
+    workgroup::WorkGroupPtr _wg;
+
+    std::atomic<int64_t> _buffered_bytes{0};
+    std::atomic<int64_t> _spilling_bytes{0};
+    std::atomic<int64_t> _spilled_bytes{0};
+    std::vector<std::string> _column_names;
+    std::unordered_map<std::string, PartitionData> _partitions;
+
+    spill::SpillerFactoryPtr _spiller_factory;
+    std::shared_ptr<spill::Spiller> _spiller;
+
+    std::atomic<bool> _pending_task{false};
+    std::atomic<bool> _spill_failed{false};
+    mutable std::mutex _task_status_lock;
+    Status _task_status;
+};
+
+} // namespace starrocks::connector
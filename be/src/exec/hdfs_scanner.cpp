@@ -90,6 +90,7 @@ Status HdfsScanner::init(RuntimeState* runtime_state, const HdfsScannerParams& s
     SCOPED_RAW_TIMER(&_total_running_time);
     _runtime_state = runtime_state;
     _scanner_params = scanner_params;
+    _sub_expr_cache.add(_scanner_params.scanner_conjunct_ctxs);
 
     RETURN_IF_ERROR(do_init(runtime_state, scanner_params));
 
@@ -207,6 +208,7 @@ Status HdfsScanner::get_next(RuntimeState* runtime_state, ChunkPtr* chunk) {
     if (status.ok()) {
         if (!_scanner_params.scanner_conjunct_ctxs.empty()) {
             SCOPED_RAW_TIMER(&_app_stats.expr_filter_ns);
+            SubExprCacheScope sub_expr_cache_scope(&_sub_expr_cache);
             RETURN_IF_ERROR(ExecNode::eval_conjuncts(_scanner_params.scanner_conjunct_ctxs, (*chunk).get()));
         }
     } else if (status.is_end_of_file()) {
@@ -249,6 +251,28 @@ void HdfsScanner::close() noexcept {
     _file.reset(nullptr);
 }
 
+static io::SharedBufferedInputStream::CoalesceOptions coalesce_options_of(FileSystem::Type fs_type) {
+    int64_t latency_us = 0;
+    int64_t bandwidth_mb = 0;
+    switch (fs_type) {
+    case FileSystem::POSIX:
+    case FileSystem::MEMORY:
+        latency_us = config::io_coalesce_local_latency_us;
+        bandwidth_mb = config::io_coalesce_local_bandwidth_mb;
+        break;
+    case FileSystem::HDFS:
+        latency_us = config::io_coalesce_hdfs_latency_us;
+        bandwidth_mb = config::io_coalesce_hdfs_bandwidth_mb;
+        break;
+    default:
+        latency_us = config::io_coalesce_object_store_latency_us;
+        bandwidth_mb = config::io_coalesce_object_store_bandwidth_mb;
+        break;
+    }
+    return io::SharedBufferedInputStream::CoalesceOptions::from_io_cost(latency_us, bandwidth_mb,
+                                                                        config::io_coalesce_read_max_buffer_size);
+}
+
 StatusOr<std::unique_ptr<RandomAccessFile>> HdfsScanner::create_random_access_file(
         std::shared_ptr<io::SharedBufferedInputStream>& shared_buffered_input_stream,
         std::shared_ptr<io::CacheInputStream>& cache_input_stream, const OpenFileOptions& options) {
@@ -265,10 +289,15 @@ StatusOr<std::unique_ptr<RandomAccessFile>> HdfsScanner::create_random_access_fi
     input_stream = std::make_shared<CountedSeekableInputStream>(input_stream, options.fs_stats);
 
     shared_buffered_input_stream = std::make_shared<io::SharedBufferedInputStream>(input_stream, filename, file_size);
-    const io::SharedBufferedInputStream::CoalesceOptions shared_options = {
-            .max_dist_size = config::io_coalesce_read_max_distance_size,
-            .max_buffer_size = config::io_coalesce_read_max_buffer_size};
-    shared_buffered_input_stream->set_coalesce_options(shared_options);
+    const bool cost_based_coalesce = config::io_coalesce_cost_based_enable;
+    if (cost_based_coalesce) {
+        shared_buffered_input_stream->set_coalesce_options(coalesce_options_of(options.fs->type()));
+    } else {
+        const io::SharedBufferedInputStream::CoalesceOptions shared_options = {
+                .max_dist_size = config::io_coalesce_read_max_distance_size,
+                .max_buffer_size = config::io_coalesce_read_max_buffer_size};
+        shared_buffered_input_stream->set_coalesce_options(shared_options);
+    }
     input_stream = shared_buffered_input_stream;
 
     // input_stream = CacheInputStream(input_stream)
@@ -289,6 +318,14 @@ StatusOr<std::unique_ptr<RandomAccessFile>> HdfsScanner::create_random_access_fi
         cache_input_stream->set_priority(datacache_options.datacache_priority);
         cache_input_stream->set_ttl_seconds(datacache_options.datacache_ttl_seconds);
         shared_buffered_input_stream->set_align_size(cache_input_stream->get_align_size());
+        if (cost_based_coalesce && !datacache_options.enable_cache_select) {
+            // the shared buffered stream is owned by the cache stream, do not keep the cache stream alive
+            std::weak_ptr<io::CacheInputStream> weak_cache_stream = cache_input_stream;
+            shared_buffered_input_stream->set_cached_range_checker([weak_cache_stream](int64_t offset, int64_t size) {
+                auto cache_stream = weak_cache_stream.lock();
+                return cache_stream != nullptr && cache_stream->is_cached(offset, size);
+            });
+        }
     }
 
     // if compression
@@ -488,6 +525,10 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->shared_buffered_direct_io_count, _shared_buffered_input_stream->direct_io_count());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_bytes, _shared_buffered_input_stream->direct_io_bytes());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_timer, _shared_buffered_input_stream->direct_io_timer());
+        COUNTER_UPDATE(profile->shared_buffered_skip_cached_io_count,
+                       _shared_buffered_input_stream->skipped_cached_io_count());
+        COUNTER_UPDATE(profile->shared_buffered_skip_cached_io_bytes,
+                       _shared_buffered_input_stream->skipped_cached_io_bytes());
     }
 
     {
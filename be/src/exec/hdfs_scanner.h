@@ -23,6 +23,7 @@
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
 #include "exprs/runtime_filter_bank.h"
+#include "exprs/sub_expr_cache.h"
 #include "fs/fs.h"
 #include "io/cache_input_stream.h"
 #include "io/shared_buffered_input_stream.h"
@@ -187,6 +188,8 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* shared_buffered_direct_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_bytes = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_timer = nullptr;
+    RuntimeProfile::Counter* shared_buffered_skip_cached_io_count = nullptr;
+    RuntimeProfile::Counter* shared_buffered_skip_cached_io_bytes = nullptr;
 
     RuntimeProfile::Counter* app_io_bytes_read_counter = nullptr;
     RuntimeProfile::Counter* app_io_timer = nullptr;
@@ -472,6 +475,9 @@ private:
     Status _build_scanner_context();
     void update_hdfs_counter(HdfsScanProfile* profile);
 
+    // shares the function calls repeated in the scanner conjuncts
+    SubExprCache _sub_expr_cache;
+
 protected:
     HdfsScannerContext _scanner_ctx;
     HdfsScannerParams _scanner_params;
@@ -16,6 +16,7 @@
 
 #include <utility>
 
+#include "cache/object_cache/object_cache.h"
 #include "exec/exec_node.h"
 #include "exec/iceberg/iceberg_delete_builder.h"
 #include "exec/paimon/paimon_delete_file_builder.h"
@@ -24,7 +25,9 @@
 #include "formats/orc/orc_memory_pool.h"
 #include "formats/orc/orc_min_max_decoder.h"
 #include "formats/orc/utils.h"
+#include "formats/parquet/utils.h"
 #include "gen_cpp/orc_proto.pb.h"
+#include "runtime/exec_env.h"
 #include "simd/simd.h"
 #include "storage/chunk_helper.h"
 #include "util/runtime_profile.h"
@@ -466,6 +469,41 @@ Status HdfsOrcScanner::build_split_tasks(orc::Reader* reader, const std::vector<
     return Status::OK();
 }
 
+std::shared_ptr<std::string> HdfsOrcScanner::lookup_file_tail_cache(ObjectCache* cache, const std::string& key) {
+    SCOPED_RAW_TIMER(&_app_stats.footer_cache_read_ns);
+    ObjectCacheHandle* handle = nullptr;
+    if (!cache->lookup(key, &handle).ok()) {
+        return nullptr;
+    }
+    auto file_tail = *(static_cast<const std::shared_ptr<std::string>*>(cache->value(handle)));
+    cache->release(handle);
+    _app_stats.footer_cache_read_count += 1;
+    return file_tail;
+}
+
+void HdfsOrcScanner::insert_file_tail_cache(ObjectCache* cache, const std::string& key,
+                                            std::shared_ptr<std::string> file_tail) {
+    const size_t size = file_tail->size();
+    if (size == 0) {
+        return;
+    }
+    // cache does not understand shared ptr, so we have to new an object to hold it.
+    auto* capture = new std::shared_ptr<std::string>(std::move(file_tail));
+    auto deleter = [](const CacheKey& key, void* value) { delete (std::shared_ptr<std::string>*)value; };
+    ObjectCacheWriteOptions options;
+    options.evict_probability = _scanner_params.datacache_options.datacache_evict_probability;
+    ObjectCacheHandle* handle = nullptr;
+    Status st = cache->insert(key, capture, size, deleter, &handle, &options);
+    if (st.ok()) {
+        _app_stats.footer_cache_write_bytes += size;
+        _app_stats.footer_cache_write_count += 1;
+        cache->release(handle);
+    } else {
+        _app_stats.footer_cache_write_fail_count += 1;
+        delete capture;
+    }
+}
+
 Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
     // create wrapped input stream.
     RETURN_IF_ERROR(open_random_access_file());
@@ -479,6 +517,18 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
 
     // create orc reader on this input stream.
     SCOPED_RAW_TIMER(&_app_stats.reader_init_ns);
+    ObjectCache* file_tail_cache = nullptr;
+    std::string file_tail_cache_key;
+    std::shared_ptr<std::string> file_tail = nullptr;
+    if (_scanner_ctx.split_context == nullptr && _scanner_ctx.use_file_metacache) {
+        file_tail_cache = CacheEnv::GetInstance()->external_table_meta_cache();
+    }
+    if (file_tail_cache != nullptr) {
+        file_tail_cache_key = parquet::ParquetUtils::get_file_cache_key(
+                parquet::CacheType::ORC_FILE_TAIL, _file->filename(),
+                _scanner_params.datacache_options.modification_time, orc_hdfs_file_stream->getLength());
+        file_tail = lookup_file_tail_cache(file_tail_cache, file_tail_cache_key);
+    }
     std::unique_ptr<orc::Reader> reader;
     try {
         errno = 0;
@@ -487,8 +537,14 @@ Status HdfsOrcScanner::do_open(RuntimeState* runtime_state) {
         if (_scanner_ctx.split_context != nullptr) {
             auto* split_context = down_cast<const SplitContext*>(_scanner_ctx.split_context);
             options.setSerializedFileTail(*(split_context->footer.get()));
+        } else if (file_tail != nullptr) {
+            options.setSerializedFileTail(*file_tail);
         }
         reader = orc::createReader(std::move(_input_stream), options);
+        if (file_tail_cache != nullptr && file_tail == nullptr) {
+            insert_file_tail_cache(file_tail_cache, file_tail_cache_key,
+                                   std::make_shared<std::string>(reader->getSerializedFileTail()));
+        }
     } catch (std::exception& e) {
         bool is_not_found = (errno == ENOENT);
         auto s = strings::Substitute("HdfsOrcScanner::do_open failed. reason = $0", e.what());
@@ -770,6 +826,22 @@ void HdfsOrcScanner::do_update_counter(HdfsScanProfile* profile) {
     COUNTER_UPDATE(stripe_active_lazy_coalesce_seperately_counter,
                    _app_stats.orc_stripe_active_lazy_coalesce_seperately);
 
+    RuntimeProfile::Counter* footer_cache_write_counter =
+            ADD_CHILD_COUNTER(root_profile, "FooterCacheWriteCount", TUnit::UNIT, orcProfileSectionPrefix);
+    RuntimeProfile::Counter* footer_cache_write_bytes =
+            ADD_CHILD_COUNTER(root_profile, "FooterCacheWriteBytes", TUnit::BYTES, orcProfileSectionPrefix);
+    RuntimeProfile::Counter* footer_cache_write_fail_counter =
+            ADD_CHILD_COUNTER(root_profile, "FooterCacheWriteFailCount", TUnit::UNIT, orcProfileSectionPrefix);
+    RuntimeProfile::Counter* footer_cache_read_counter =
+            ADD_CHILD_COUNTER(root_profile, "FooterCacheReadCount", TUnit::UNIT, orcProfileSectionPrefix);
+    RuntimeProfile::Counter* footer_cache_read_timer =
+            ADD_CHILD_TIMER(root_profile, "FooterCacheReadTimer", orcProfileSectionPrefix);
+    COUNTER_UPDATE(footer_cache_write_counter, _app_stats.footer_cache_write_count);
+    COUNTER_UPDATE(footer_cache_write_bytes, _app_stats.footer_cache_write_bytes);
+    COUNTER_UPDATE(footer_cache_write_fail_counter, _app_stats.footer_cache_write_fail_count);
+    COUNTER_UPDATE(footer_cache_read_counter, _app_stats.footer_cache_read_count);
+    COUNTER_UPDATE(footer_cache_read_timer, _app_stats.footer_cache_read_ns);
+
     if (_orc_reader != nullptr) {
         // _orc_reader is nullptr for split task
         root_profile->add_info_string("ORCSearchArgument: ", _orc_reader->get_search_argument_string());
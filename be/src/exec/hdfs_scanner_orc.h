@@ -23,6 +23,7 @@
 
 namespace starrocks {
 
+class ObjectCache;
 class OrcRowReaderFilter;
 
 class HdfsOrcScanner final : public HdfsScanner {
@@ -58,6 +59,11 @@ private:
     Status build_io_ranges(ORCHdfsFileStream* file_stream, const std::vector<DiskRange>& stripes);
     Status resolve_columns(orc::Reader* reader);
 
+    // The serialized file tail (postscript, footer and metadata) of orc files is cached in the external table
+    // meta cache, so that the tail is not read and parsed again when the file is opened by later scans.
+    std::shared_ptr<std::string> lookup_file_tail_cache(ObjectCache* cache, const std::string& key);
+    void insert_file_tail_cache(ObjectCache* cache, const std::string& key, std::shared_ptr<std::string> file_tail);
+
     // disable orc search argument would be much easier for
     // writing unittest of customized filter
     bool _use_orc_sargs;
@@ -518,13 +518,13 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
 
     faststring buffer;
     try {
-        uint32_t key_index = 0;
+        // position of the next expected key in _prev_parsed_position
+        size_t key_index = 0;
         for (auto field : *row) {
-            int column_index;
             std::string_view key = field_unescaped_key_safe(field, &buffer);
 
-            // _prev_parsed_position records the chunk column index for each key of previous parsed json object.
-            // For example, if previous json object is
+            // _prev_parsed_position records the chunk column index for each key of previous parsed json objects,
+            // in the key order of the json objects. For example, if previous json object is
             // {
             //      'a':1,
             //      'b':2,
@@ -534,56 +534,50 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
             // At this time, suppose the next parsed json object is
             // {
             //      'a':10,
-            //      'b':15,
-            //      'c':25
+            //      'c':25,
+            //      'b':15
             // }
-            // through the _prev_parsed_position, we can know that the column index for 'a' is 1, and the column
-            // index for 'b' is 2. Since previous parsed json object doesn't contain 'c', key 'c' 's column index
-            // needs to be searched from the _slot_desc_dict, and if the key 'c' refers to the 3rd column of chunk,
-            // then we will update the _prev_parsed_position to be [{'a', 1, int}, {'b', 2, int}, {'c', 3, int}].
-            if (LIKELY(_prev_parsed_position.size() > key_index && _prev_parsed_position[key_index].key == key)) {
-                // obtain column_index from previous parsed position
-                column_index = _prev_parsed_position[key_index].column_index;
-                if (column_index < 0) {
-                    // column_index < 0 means key is not in the slot dict, and we will skip this field
-                    key_index++;
-                    continue;
-                }
-            } else {
+            // through the _prev_parsed_position, we can know that the column index for 'a' is 1. Since previous
+            // parsed json object doesn't contain 'c', key 'c' 's column index needs to be searched from the
+            // _slot_desc_dict, and if the key 'c' refers to the 3rd column of chunk, then we will insert it to
+            // _prev_parsed_position, which becomes [{'a', 1, int}, {'c', 3, int}, {'b', 2, int}].
+            // Objects which omit some optional keys, e.g. {'a':10, 'b':15}, still hit the recorded positions by
+            // looking ahead a few keys, so that objects with and without optional keys do not evict each other.
+            size_t pos = key_index;
+            const size_t look_ahead_end = std::min(_prev_parsed_position.size(), key_index + kMaxKeyLookAhead + 1);
+            while (pos < look_ahead_end && _prev_parsed_position[pos].key != key) {
+                pos++;
+            }
+            if (UNLIKELY(pos == look_ahead_end)) {
                 // look up key in the slot dict.
+                pos = key_index;
+                PreviousParsedItem item(key);
                 auto itr = _slot_desc_dict.find(key);
-                if (itr == _slot_desc_dict.end()) {
-                    // parsed key of the json object is not in the slot dict, and we will skip this field
-                    if (_prev_parsed_position.size() <= key_index) {
-                        _prev_parsed_position.emplace_back(key);
-                    } else {
-                        _prev_parsed_position[key_index].key = key;
-                        _prev_parsed_position[key_index].column_index = -1;
-                    }
-                    key_index++;
-                    continue;
+                if (itr != _slot_desc_dict.end()) {
+                    item.column_index = chunk->get_index_by_slot_id(itr->second->id());
+                    item.type = &_type_desc_dict.at(key);
                 }
-
-                auto slot_desc = itr->second;
-                auto type_desc = _type_desc_dict[key];
-
-                // update the prev parsed position
-                column_index = chunk->get_index_by_slot_id(slot_desc->id());
-                if (_prev_parsed_position.size() <= key_index) {
-                    _prev_parsed_position.emplace_back(key, column_index, type_desc);
+                // bound the recorded keys in case of the keys of json objects are in random order.
+                if (_prev_parsed_position.size() < std::max(kMinParsedPositions, 2 * chunk->num_columns())) {
+                    _prev_parsed_position.insert(_prev_parsed_position.begin() + pos, std::move(item));
+                } else if (pos < _prev_parsed_position.size()) {
+                    _prev_parsed_position[pos] = std::move(item);
                 } else {
-                    _prev_parsed_position[key_index].key = key;
-                    _prev_parsed_position[key_index].column_index = column_index;
-                    _prev_parsed_position[key_index].type = type_desc;
+                    _prev_parsed_position.emplace_back(std::move(item));
                 }
             }
+            key_index = pos + 1;
 
-            DCHECK(column_index >= 0);
+            const PreviousParsedItem& item = _prev_parsed_position[pos];
+            int column_index = item.column_index;
+            if (column_index < 0) {
+                // column_index < 0 means key is not in the slot dict, and we will skip this field
+                continue;
+            }
             if (_parsed_columns[column_index]) {
                 // {'a': 1, 'b': 1, 'b': 1}
                 // there may be duplicated keys in single json, this will cause inconsistent column rows,
                 // so skip the duplicated key
-                key_index++;
                 continue;
             } else {
                 _parsed_columns[column_index] = true;
@@ -592,10 +586,7 @@ Status JsonReader::_construct_row_without_jsonpath(simdjson::ondemand::object* r
             simdjson::ondemand::value val = field.value();
 
             // construct column with value.
-            RETURN_IF_ERROR(_construct_column(val, column.get(), _prev_parsed_position[key_index].type,
-                                              _prev_parsed_position[key_index].key));
-
-            key_index++;
+            RETURN_IF_ERROR(_construct_column(val, column.get(), *item.type, item.key));
         }
     } catch (simdjson::simdjson_error& e) {
         auto err_msg = strings::Substitute("construct row in object order failed, error: $0",
@@ -101,11 +101,12 @@ public:
 
     struct PreviousParsedItem {
         PreviousParsedItem(const std::string_view& key) : key(key), column_index(-1) {}
-        PreviousParsedItem(const std::string_view& key, int column_index, const TypeDescriptor& type)
+        PreviousParsedItem(const std::string_view& key, int column_index, const TypeDescriptor* type)
                 : key(key), type(type), column_index(column_index) {}
 
         std::string key;
-        TypeDescriptor type;
+        // points to the value of _type_desc_dict, nullptr if the key is not in the slot dict
+        const TypeDescriptor* type = nullptr;
         int column_index;
     };
 
@@ -155,7 +156,11 @@ private:
     std::unique_ptr<JsonParser> _parser;
     bool _empty_parser = true;
 
-    // record the chunk column position for previous parsed json object
+    // the number of recorded keys which could be skipped when matching a key with _prev_parsed_position
+    static constexpr size_t kMaxKeyLookAhead = 4;
+    // the min capacity of _prev_parsed_position, keys are not inserted anymore once it is full
+    static constexpr size_t kMinParsedPositions = 64;
+    // record the chunk column position for previous parsed json objects, in the key order of the json objects
     std::vector<PreviousParsedItem> _prev_parsed_position;
     // record the parsed column index for current json object
     std::vector<uint8_t> _parsed_columns;
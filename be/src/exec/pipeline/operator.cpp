@@ -179,6 +179,7 @@ Status Operator::eval_conjuncts_and_in_filters(const std::vector<ExprContext*>&
         auto& in_filters = runtime_in_filters();
         _cached_conjuncts_and_in_filters.insert(_cached_conjuncts_and_in_filters.end(), in_filters.begin(),
                                                 in_filters.end());
+        _conjuncts_sub_expr_cache.add(_cached_conjuncts_and_in_filters);
         _conjuncts_and_in_filters_is_cached = true;
     }
     if (_cached_conjuncts_and_in_filters.empty()) {
@@ -192,6 +193,7 @@ Status Operator::eval_conjuncts_and_in_filters(const std::vector<ExprContext*>&
         SCOPED_TIMER(_conjuncts_timer);
         auto before = chunk->num_rows();
         _conjuncts_input_counter->update(before);
+        SubExprCacheScope sub_expr_cache_scope(&_conjuncts_sub_expr_cache);
         RETURN_IF_ERROR(
                 starrocks::ExecNode::eval_conjuncts(_cached_conjuncts_and_in_filters, chunk, filter, apply_filter));
         auto after = chunk->num_rows();
@@ -22,6 +22,7 @@
 #include "exec/pipeline/schedule/observer.h"
 #include "exec/spill/operator_mem_resource_manager.h"
 #include "exprs/runtime_filter_bank.h"
+#include "exprs/sub_expr_cache.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_tracker.h"
 #include "util/runtime_profile.h"
@@ -298,6 +299,8 @@ protected:
 
     bool _conjuncts_and_in_filters_is_cached = false;
     std::vector<ExprContext*> _cached_conjuncts_and_in_filters;
+    // shares the function calls repeated in _cached_conjuncts_and_in_filters, built along with them
+    SubExprCache _conjuncts_sub_expr_cache;
 
     RuntimeMembershipFilterEvalContext _bloom_filter_eval_context;
 
@@ -18,6 +18,7 @@
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
 #include "exprs/expr.h"
+#include "exprs/sub_expr_cache.h"
 #include "runtime/current_thread.h"
 #include "runtime/runtime_state.h"
 
@@ -25,6 +26,8 @@ namespace starrocks::pipeline {
 Status ProjectOperator::prepare(RuntimeState* state) {
     _expr_compute_timer = ADD_TIMER(_unique_metrics, "ExprComputeTime");
     _common_sub_expr_compute_timer = ADD_TIMER(_unique_metrics, "CommonSubExprComputeTime");
+    _sub_expr_cache.add(_common_sub_expr_ctxs);
+    _sub_expr_cache.add(_expr_ctxs);
     return Operator::prepare(state);
 }
 
@@ -44,6 +47,7 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
         return Status::OK();
     }
     TRY_CATCH_ALLOC_SCOPE_START();
+    SubExprCacheScope sub_expr_cache_scope(&_sub_expr_cache);
     {
         SCOPED_TIMER(_common_sub_expr_compute_timer);
         for (size_t i = 0; i < _common_sub_column_ids.size(); ++i) {
@@ -15,6 +15,7 @@
 #pragma once
 
 #include "exec/pipeline/operator.h"
+#include "exprs/sub_expr_cache.h"
 #include "runtime/global_dict/parser.h"
 
 namespace starrocks {
@@ -66,6 +67,9 @@ private:
     const std::vector<int32_t>& _common_sub_column_ids;
     const std::vector<ExprContext*>& _common_sub_expr_ctxs;
 
+    // shares the function calls repeated in _common_sub_expr_ctxs and _expr_ctxs
+    SubExprCache _sub_expr_cache;
+
     bool _is_finished = false;
     ChunkPtr _cur_chunk = nullptr;
 
@@ -23,6 +23,7 @@
 #include "exec/workgroup/work_group_fwd.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
+#include "exprs/sub_expr_cache.h"
 #include "gen_cpp/InternalService_types.h"
 #include "runtime/runtime_state.h"
 #include "storage/conjunctive_predicates.h"
@@ -80,6 +81,8 @@ private:
     TInternalScanRange* _scan_range;
 
     PredicateTree _non_pushdown_pred_tree;
+    // shares the function calls repeated in the not push down conjuncts of the scan context
+    SubExprCache _sub_expr_cache;
     Filter _selection;
 
     ObjectPool _obj_pool;
@@ -41,6 +41,7 @@ Status ConnectorSinkOperator::prepare(RuntimeState* state) {
 #ifndef BE_TEST
     RETURN_IF_ERROR(Operator::prepare(state));
 #endif
+    _connector_chunk_sink->set_profile(_unique_metrics.get());
     RETURN_IF_ERROR(_connector_chunk_sink->init());
     return Status::OK();
 }
@@ -58,6 +59,11 @@ bool ConnectorSinkOperator::need_input() const {
     if (_no_more_input) {
         return false;
     }
+    // the io task of the chunk sink uses its writers and the io poller, wait for it
+    bool task_failed = false;
+    if (!_check_pending_task(&task_failed) || task_failed) {
+        return false;
+    }
 
     auto [status, _] = _io_poller->poll();
     if (!status.ok()) {
@@ -72,6 +78,24 @@ bool ConnectorSinkOperator::is_finished() const {
     if (!_no_more_input) {
         return false;
     }
+    bool task_failed = false;
+    if (!_check_pending_task(&task_failed)) {
+        return false;
+    }
+    if (task_failed) {
+        // the fragment is cancelled, don't write out or commit anything
+        return true;
+    }
+    if (!_sink_finished) {
+        // the chunk sink was busy when set_finishing
+        _sink_finished = true;
+        auto status = _connector_chunk_sink->finish();
+        if (!status.ok()) {
+            LOG(WARNING) << "cancel fragment: " << status;
+            _fragment_context->cancel(status);
+        }
+        return false;
+    }
 
     auto [status, finished] = _io_poller->poll();
     if (!status.ok()) {
@@ -82,8 +106,26 @@ bool ConnectorSinkOperator::is_finished() const {
     return finished;
 }
 
+bool ConnectorSinkOperator::_check_pending_task(bool* failed) const {
+    if (_connector_chunk_sink->has_pending_task()) {
+        return false;
+    }
+    auto status = _connector_chunk_sink->task_status();
+    *failed = !status.ok();
+    if (*failed) {
+        LOG(WARNING) << "cancel fragment: " << status;
+        _fragment_context->cancel(status);
+    }
+    return true;
+}
+
 Status ConnectorSinkOperator::set_finishing(RuntimeState* state) {
     _no_more_input = true;
+    if (_connector_chunk_sink->has_pending_task()) {
+        // finish the chunk sink in is_finished once the task is done
+        return Status::OK();
+    }
+    _sink_finished = true;
     RETURN_IF_ERROR(_connector_chunk_sink->finish());
     return Status::OK();
 }
@@ -57,12 +57,18 @@ public:
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
 
 private:
+    // Returns false if an io task of the chunk sink is pending. Otherwise sets |failed| and cancels the fragment if
+    // some io task failed, the caller must not finish the chunk sink then.
+    bool _check_pending_task(bool* failed) const;
+
     std::unique_ptr<connector::ConnectorChunkSink> _connector_chunk_sink;
     std::unique_ptr<connector::AsyncFlushStreamPoller> _io_poller;
     std::shared_ptr<connector::SinkMemoryManager> _sink_mem_mgr;
     connector::SinkOperatorMemoryManager* _op_mem_mgr; // child of _sink_mem_mgr
 
     bool _no_more_input = false;
+    // whether ConnectorChunkSink::finish is called, it's deferred while an io task of the chunk sink is pending
+    mutable bool _sink_finished = false;
     bool _is_cancelled = false;
     FragmentContext* _fragment_context;
 };
@@ -109,6 +109,8 @@ Status ProjectNode::open(RuntimeState* state) {
 
     RETURN_IF_ERROR(Expr::open(_common_sub_expr_ctxs, state));
     RETURN_IF_ERROR(Expr::open(_expr_ctxs, state));
+    _sub_expr_cache.add(_common_sub_expr_ctxs);
+    _sub_expr_cache.add(_expr_ctxs);
     return Status::OK();
 }
 
@@ -134,6 +136,7 @@ Status ProjectNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
         return Status::OK();
     }
 
+    SubExprCacheScope sub_expr_cache_scope(&_sub_expr_cache);
     {
         SCOPED_TIMER(_common_sub_expr_compute_timer);
         for (size_t i = 0; i < _common_sub_slot_ids.size(); ++i) {
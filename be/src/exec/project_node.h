@@ -17,6 +17,7 @@
 #include "column/vectorized_fwd.h"
 #include "exec/exec_node.h"
 #include "exprs/expr_context.h"
+#include "exprs/sub_expr_cache.h"
 #include "runtime/global_dict/parser.h"
 #include "util/runtime_profile.h"
 
@@ -49,6 +50,8 @@ private:
 
     std::vector<SlotId> _common_sub_slot_ids;
     std::vector<ExprContext*> _common_sub_expr_ctxs;
+    // shares the function calls repeated in _common_sub_expr_ctxs and _expr_ctxs
+    SubExprCache _sub_expr_cache;
 
     RuntimeProfile::Counter* _expr_compute_timer = nullptr;
     RuntimeProfile::Counter* _common_sub_expr_compute_timer = nullptr;
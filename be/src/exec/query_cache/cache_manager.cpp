@@ -14,29 +14,112 @@
 
 #include "exec/query_cache/cache_manager.h"
 
+#include "common/config.h"
+#include "exec/query_cache/disk_cache_tier.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
+
 namespace starrocks::query_cache {
 
+namespace {
+// CacheEntry is the value kept in LRU cache, the deleter of LRU cache is a plain function, so the entry carries
+// the CacheManager to which evicted value is handed over.
+struct CacheEntry {
+    CacheManager* owner;
+    CacheValue value;
+};
+
+// Entries explicitly dropped(i.e. replaced by a newer version or invalidated) should not go to disk tier, the
+// deleter is called synchronously by the thread which drops the entries.
+thread_local bool tls_discard_evicted_entries = false;
+} // namespace
+
 CacheManager::CacheManager(size_t capacity) : _cache(capacity) {}
-static void delete_cache_entry(const CacheKey& key, void* value) {
-    auto* cache_value = (CacheValue*)value;
-    delete cache_value;
+
+CacheManager::~CacheManager() {
+    if (_spill_pool != nullptr) {
+        _spill_pool->shutdown();
+    }
+    tls_discard_evicted_entries = true;
+    DeferOp defer([]() { tls_discard_evicted_entries = false; });
+    // Drop entries before disk tier is destructed.
+    _cache.prune();
+}
+
+Status CacheManager::enable_disk_tier(spill::DirManager* dir_mgr, size_t disk_capacity, bool async) {
+    if (async) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("query_cache_spill")
+                                .set_min_threads(1)
+                                .set_max_threads(1)
+                                .set_max_queue_size(config::query_cache_disk_spill_queue_size)
+                                .build(&_spill_pool));
+    }
+    auto disk_tier = std::make_unique<DiskCacheTier>(dir_mgr, disk_capacity);
+    RETURN_IF_ERROR(disk_tier->init());
+    _disk_tier = std::move(disk_tier);
+    return Status::OK();
+}
+
+void CacheManager::_delete_cache_entry(const CacheKey& key, void* value) {
+    auto* entry = reinterpret_cast<CacheEntry*>(value);
+    if (entry->owner->_disk_tier != nullptr && !tls_discard_evicted_entries) {
+        entry->owner->_spill_to_disk(key.to_string(), std::move(entry->value));
+    }
+    delete entry;
+}
+
+void CacheManager::_spill_to_disk(const std::string& key, CacheValue&& value) {
+    // The entry may be populated again or invalidated before the value is written by the spill thread, the ticket
+    // tells the disk tier to drop the stale value in that case.
+    auto ticket = _disk_tier->prepare_put(key);
+    auto spill = [this, key, ticket, value = std::move(value)]() {
+        auto st = _disk_tier->put(key, value, ticket);
+        LOG_IF(WARNING, !st.ok() && !st.is_not_supported()) << "Fail to spill query cache entry: " << st;
+    };
+    if (_spill_pool == nullptr) {
+        spill();
+        return;
+    }
+    // The cache value is just dropped if the spill queue is full.
+    if (!_spill_pool->submit_func(std::move(spill)).ok()) {
+        _disk_tier->cancel_put(key, ticket);
+    }
 }
 
 void CacheManager::populate(const std::string& key, const CacheValue& value) {
-    auto* cache_value = new CacheValue(value);
-    size_t value_size = cache_value->size();
-    auto* handle = _cache.insert(key, cache_value, value_size, &delete_cache_entry, CachePriority::NORMAL);
+    auto* entry = new CacheEntry{this, value};
+    size_t value_size = entry->value.size();
+    if (_disk_tier != nullptr) {
+        // the stale version of the entry should be neither spilled nor promoted any more.
+        tls_discard_evicted_entries = true;
+        DeferOp defer([]() { tls_discard_evicted_entries = false; });
+        _cache.erase(key);
+        _disk_tier->erase(key);
+    }
+    auto* handle = _cache.insert(key, entry, value_size, &_delete_cache_entry, CachePriority::NORMAL);
     _cache.release(handle);
 }
 
 StatusOr<CacheValue> CacheManager::probe(const std::string& key) {
     auto* handle = _cache.lookup(key);
     if (handle == nullptr) {
-        return Status::NotFound("CacheMiss");
+        if (_disk_tier == nullptr) {
+            return Status::NotFound("CacheMiss");
+        }
+        // promote the entry hit in disk tier back to memory
+        auto res = _disk_tier->take(key);
+        if (!res.ok()) {
+            LOG_IF(WARNING, !res.status().is_not_found()) << "Fail to load query cache entry: " << res.status();
+            return Status::NotFound("CacheMiss");
+        }
+        auto* entry = new CacheEntry{this, std::move(res.value())};
+        CacheValue cache_value(entry->value);
+        auto* promoted = _cache.insert(key, entry, entry->value.size(), &_delete_cache_entry, CachePriority::NORMAL);
+        _cache.release(promoted);
+        return cache_value;
     }
     DeferOp defer([this, handle]() { _cache.release(handle); });
-    CacheValue cache_value(*reinterpret_cast<CacheValue*>(_cache.value(handle)));
+    CacheValue cache_value(reinterpret_cast<CacheEntry*>(_cache.value(handle))->value);
     return cache_value;
 }
 
@@ -56,11 +139,32 @@ size_t CacheManager::hit_count() {
     return _cache.get_hit_count();
 }
 
+size_t CacheManager::disk_usage() {
+    return _disk_tier == nullptr ? 0 : _disk_tier->usage();
+}
+
+size_t CacheManager::disk_capacity() {
+    return _disk_tier == nullptr ? 0 : _disk_tier->capacity();
+}
+
+size_t CacheManager::disk_lookup_count() {
+    return _disk_tier == nullptr ? 0 : _disk_tier->lookup_count();
+}
+
+size_t CacheManager::disk_hit_count() {
+    return _disk_tier == nullptr ? 0 : _disk_tier->hit_count();
+}
+
 void CacheManager::invalidate_all() {
     auto old_capacity = _cache.get_capacity();
+    tls_discard_evicted_entries = true;
+    DeferOp defer([]() { tls_discard_evicted_entries = false; });
     // set capacity of cache to zero, the cache shall prune all cache entries.
     _cache.set_capacity(0);
     _cache.set_capacity(old_capacity);
+    if (_disk_tier != nullptr) {
+        _disk_tier->clear();
+    }
 }
 
 } // namespace starrocks::query_cache
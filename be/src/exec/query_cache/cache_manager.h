@@ -24,8 +24,16 @@
 #include "util/lru_cache.h"
 #include "util/slice.h"
 
+namespace starrocks {
+class ThreadPool;
+namespace spill {
+class DirManager;
+}
+} // namespace starrocks
+
 namespace starrocks::query_cache {
 class CacheManager;
+class DiskCacheTier;
 using CacheManagerRawPtr = CacheManager*;
 using CacheManagerPtr = std::shared_ptr<CacheManager>;
 
@@ -60,20 +68,35 @@ struct CacheValue {
     }
 };
 
+// CacheManager keeps cache values in a memory LRU cache, and optionally in a disk tier: the values evicted from
+// memory are written to local spill directories by a background thread, and promoted back to memory on a hit.
 class CacheManager {
 public:
     explicit CacheManager(size_t capacity);
-    ~CacheManager() = default;
+    ~CacheManager();
+    // Enable disk tier with the given capacity in bytes. if async is false, the evicted values are written to disk
+    // in the thread that evicts them, which is only used in unit tests.
+    Status enable_disk_tier(spill::DirManager* dir_mgr, size_t disk_capacity, bool async = true);
     void populate(const std::string& key, const CacheValue& value);
     StatusOr<CacheValue> probe(const std::string& key);
     size_t memory_usage();
     size_t capacity();
     size_t lookup_count();
     size_t hit_count();
+    bool has_disk_tier() const { return _disk_tier != nullptr; }
+    size_t disk_usage();
+    size_t disk_capacity();
+    size_t disk_lookup_count();
+    size_t disk_hit_count();
     // vacuum cache by invalidate all cache entries
     void invalidate_all();
 
 private:
+    static void _delete_cache_entry(const CacheKey& key, void* value);
+    void _spill_to_disk(const std::string& key, CacheValue&& value);
+
     ShardedLRUCache _cache;
+    std::unique_ptr<DiskCacheTier> _disk_tier;
+    std::unique_ptr<ThreadPool> _spill_pool;
 };
 } // namespace starrocks::query_cache
@@ -20,12 +20,16 @@
 
 #include "column/vectorized_fwd.h"
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "exec/pipeline/pipeline_driver.h"
 #include "storage/lake/tablet.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/rowset/base_rowset.h"
+#include "storage/data_dir.h"
+#include "storage/del_vector.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
+#include "storage/update_manager.h"
 #include "util/time.h"
 
 namespace starrocks::query_cache {
@@ -301,28 +305,14 @@ void CacheOperator::_handle_stale_cache_value_for_non_pk(int64_t tablet_id, Cach
         return;
     }
 
-    buffer->cached_version = cache_value.version;
-    auto chunks = remap_chunks(cache_value.result, _cache_param.reverse_slot_remapping);
-    _update_probe_metrics(tablet_id, chunks);
-    buffer->chunks = std::move(chunks);
     // case 2: all delta versions are empty rowsets, so the cache result is hit totally.
     if (all_rs_empty) {
-        buffer->state = PLBS_HIT_TOTAL;
-        buffer->chunks.back()->owner_info().set_last_chunk(true);
+        _set_total_hit(tablet_id, cache_value, buffer);
         return;
     }
     // case 3: otherwise, the cache result is partial result of per-tablet computation, so delta versions must
     //  be scanned and merged with cache result to generate total result.
-    buffer->state = PLBS_HIT_PARTIAL;
-    buffer->rowsets = std::move(base_rowsets);
-    buffer->rowsets_acq_rel = std::move(rowsets_acq_rel);
-    buffer->num_rows = 0;
-    buffer->num_bytes = 0;
-    for (const auto& chunk : buffer->chunks) {
-        buffer->num_rows += chunk->num_rows();
-        buffer->num_bytes += chunk->bytes_usage();
-    }
-    buffer->chunks.back()->owner_info().set_last_chunk(false);
+    _set_partial_hit(tablet_id, cache_value, buffer, std::move(base_rowsets), std::move(rowsets_acq_rel));
 }
 
 void CacheOperator::_handle_stale_cache_value_for_pk(int64_t tablet_id, starrocks::query_cache::CacheValue& cache_value,
@@ -346,11 +336,30 @@ void CacheOperator::_handle_stale_cache_value_for_pk(int64_t tablet_id, starrock
             can_pickup_delta_rowsets |= rs->start_version() == snapshot_version + 1;
             exists_non_empty_delta_rowsets |= rs->start_version() > snapshot_version && rs->has_data_files();
         }
-        if (exists_non_empty_delta_rowsets || !can_pickup_delta_rowsets) {
+        if (!can_pickup_delta_rowsets) {
             buffer->state = PLBS_MISS;
             buffer->cached_version = 0;
             return;
         }
+        // The delta rowsets only append new keys, so PK tablet behaves like a DUP_KEYS tablet in the delta versions,
+        // the cache result is reused in the same way as multi-version cache for non-pk tablets.
+        if (exists_non_empty_delta_rowsets) {
+            if (!config::enable_query_cache_pk_incremental_refresh || !_cache_param.can_use_multiversion ||
+                !_is_append_only_delta_for_pk(tablet.get(), rowsets, snapshot_version, version)) {
+                buffer->state = PLBS_MISS;
+                buffer->cached_version = 0;
+                return;
+            }
+            std::vector<BaseRowsetSharedPtr> delta_rowsets;
+            for (auto& rs : rowsets) {
+                if (rs->start_version() > snapshot_version) {
+                    delta_rowsets.emplace_back(std::static_pointer_cast<BaseRowset>(rs));
+                }
+            }
+            buffer->tablet = std::static_pointer_cast<BaseTablet>(tablet);
+            _set_partial_hit(tablet_id, cache_value, buffer, std::move(delta_rowsets), std::move(rowsets_acq_rel));
+            return;
+        }
 
     } else {
         auto status = ExecEnv::GetInstance()->lake_tablet_manager()->capture_tablet_and_rowsets(
@@ -370,6 +379,10 @@ void CacheOperator::_handle_stale_cache_value_for_pk(int64_t tablet_id, starrock
         }
     }
 
+    _set_total_hit(tablet_id, cache_value, buffer);
+}
+
+void CacheOperator::_set_total_hit(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer) {
     buffer->cached_version = cache_value.version;
     auto chunks = remap_chunks(cache_value.result, _cache_param.reverse_slot_remapping);
     _update_probe_metrics(tablet_id, chunks);
@@ -378,6 +391,54 @@ void CacheOperator::_handle_stale_cache_value_for_pk(int64_t tablet_id, starrock
     buffer->chunks.back()->owner_info().set_last_chunk(true);
 }
 
+void CacheOperator::_set_partial_hit(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer,
+                                     std::vector<BaseRowsetSharedPtr>&& delta_rowsets,
+                                     RowsetsAcqRelPtr&& rowsets_acq_rel) {
+    buffer->cached_version = cache_value.version;
+    auto chunks = remap_chunks(cache_value.result, _cache_param.reverse_slot_remapping);
+    _update_probe_metrics(tablet_id, chunks);
+    buffer->chunks = std::move(chunks);
+    buffer->state = PLBS_HIT_PARTIAL;
+    buffer->rowsets = std::move(delta_rowsets);
+    buffer->rowsets_acq_rel = std::move(rowsets_acq_rel);
+    buffer->num_rows = 0;
+    buffer->num_bytes = 0;
+    for (const auto& chunk : buffer->chunks) {
+        buffer->num_rows += chunk->num_rows();
+        buffer->num_bytes += chunk->bytes_usage();
+    }
+    buffer->chunks.back()->owner_info().set_last_chunk(false);
+}
+
+bool CacheOperator::_is_append_only_delta_for_pk(Tablet* tablet, const std::vector<RowsetSharedPtr>& rowsets,
+                                                 int64_t cached_version, int64_t version) {
+    auto* meta = tablet->data_dir()->get_meta();
+    auto* update_manager = StorageEngine::instance()->update_manager();
+    for (const auto& rs : rowsets) {
+        if (rs->start_version() > cached_version) {
+            // 1. delete files and column-mode partial updates modify rows of the rowsets covered by cache entry.
+            // 2. output rowset of compaction committed after cached version contains rows covered by cache entry.
+            if (rs->num_delete_files() > 0 || rs->num_update_files() > 0 ||
+                rs->rowset_meta()->has_max_compact_input_rowset_id()) {
+                return false;
+            }
+            continue;
+        }
+        // Upserts and deletes in delta versions mark the replaced rows of old rowsets as deleted, so the delvec of
+        // every segment of old rowsets must not be changed after cached version.
+        auto rowset_seg_id = rs->rowset_meta()->get_rowset_seg_id();
+        for (auto i = 0; i < rs->num_segments(); ++i) {
+            TabletSegmentId tsid(tablet->tablet_id(), rowset_seg_id + i);
+            DelVectorPtr delvec;
+            if (!update_manager->get_del_vec(meta, tsid, version, &delvec).ok() || delvec == nullptr ||
+                delvec->version() > cached_version) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void CacheOperator::_update_probe_metrics(int64_t tablet_id, const std::vector<ChunkPtr>& chunks) {
     auto num_bytes = 0L;
     auto num_rows = 0L;
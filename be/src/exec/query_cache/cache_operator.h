@@ -24,6 +24,10 @@
 #include "exec/query_cache/multilane_operator.h"
 #include "storage/rowset/rowset.h"
 namespace starrocks {
+class Tablet;
+class RowsetsAcqRel;
+using RowsetsAcqRelPtr = std::shared_ptr<RowsetsAcqRel>;
+
 namespace pipeline {
 class PipelineDriver;
 using DriverRawPtr = PipelineDriver*;
@@ -74,6 +78,14 @@ private:
                                               int64_t version);
     void _handle_stale_cache_value_for_pk(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer,
                                           int64_t version);
+    void _set_total_hit(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer);
+    // The cache result is reused as the partial result of the tablet, |delta_rowsets| are scanned and merged with it.
+    void _set_partial_hit(int64_t tablet_id, CacheValue& cache_value, PerLaneBufferPtr& buffer,
+                          std::vector<BaseRowsetSharedPtr>&& delta_rowsets, RowsetsAcqRelPtr&& rowsets_acq_rel);
+    // Return true if the rowsets of PRIMARY_KEYS tablet whose versions are in (cached_version, version] only
+    // append new keys to the tablet, so the cache entry at cached_version can be merged with these delta rowsets.
+    static bool _is_append_only_delta_for_pk(Tablet* tablet, const std::vector<RowsetSharedPtr>& rowsets,
+                                             int64_t cached_version, int64_t version);
     bool _should_passthrough(size_t num_rows, size_t num_bytes);
     ChunkPtr _pull_chunk_from_per_lane_buffer(PerLaneBufferPtr& buffer);
     CacheManagerRawPtr _cache_mgr;
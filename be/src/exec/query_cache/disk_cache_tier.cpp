@@ -0,0 +1,234 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/query_cache/disk_cache_tier.h"
+
+#include <fmt/format.h>
+
+#include "fs/fs.h"
+#include "serde/column_array_serde.h"
+#include "util/crc32c.h"
+#include "util/defer_op.h"
+#include "util/raw_container.h"
+
+namespace starrocks::query_cache {
+
+DiskCacheTier::DiskCacheTier(spill::DirManager* dir_mgr, size_t capacity) : _dir_mgr(dir_mgr), _capacity(capacity) {}
+
+DiskCacheTier::~DiskCacheTier() {
+    clear();
+}
+
+std::string DiskCacheTier::_tier_dir(const spill::Dir& dir) const {
+    return dir.dir() + "/query_cache";
+}
+
+Status DiskCacheTier::init() {
+    RETURN_IF(_dir_mgr->dirs().empty(), Status::InvalidArgument("no spill dir for the disk tier of query cache"));
+    for (const auto& dir : _dir_mgr->dirs()) {
+        auto tier_dir = _tier_dir(*dir);
+        WARN_IF_ERROR(dir->fs()->delete_dir_recursive(tier_dir), fmt::format("delete dir {} error", tier_dir));
+        RETURN_IF_ERROR(dir->fs()->create_dir_if_missing(tier_dir));
+    }
+    return Status::OK();
+}
+
+int64_t DiskCacheTier::prepare_put(const std::string& key) {
+    std::lock_guard l(_mutex);
+    auto ticket = ++_next_ticket;
+    _pending_puts[key] = ticket;
+    return ticket;
+}
+
+void DiskCacheTier::cancel_put(const std::string& key, int64_t ticket) {
+    std::lock_guard l(_mutex);
+    if (auto it = _pending_puts.find(key); it != _pending_puts.end() && it->second == ticket) {
+        _pending_puts.erase(it);
+    }
+}
+
+Status DiskCacheTier::put(const std::string& key, const CacheValue& value, int64_t ticket) {
+    // the put is finished on all the paths, the registration is dropped unless a newer put of the key is registered.
+    DeferOp unregister([&]() { cancel_put(key, ticket); });
+    if (value.result.empty()) {
+        return Status::OK();
+    }
+    Entry entry;
+    entry.key = key;
+    entry.populate_time = value.populate_time;
+    entry.version = value.version;
+
+    // 1. serialize chunks
+    size_t max_serialize_size = 0;
+    for (const auto& chunk : value.result) {
+        for (const auto& column : chunk->columns()) {
+            auto column_size = serde::ColumnArraySerde::max_serialized_size(*column);
+            RETURN_IF(column_size == 0, Status::NotSupported("unsupported column type in query cache spill"));
+            max_serialize_size += column_size;
+        }
+    }
+    RETURN_IF(max_serialize_size > _capacity, Status::ResourceBusy("cache value is larger than disk tier"));
+
+    raw::RawString serialize_buffer;
+    serialize_buffer.resize(max_serialize_size);
+    uint8_t* buf = reinterpret_cast<uint8_t*>(serialize_buffer.data());
+    uint8_t* begin = buf;
+    for (const auto& chunk : value.result) {
+        for (const auto& column : chunk->columns()) {
+            buf = serde::ColumnArraySerde::serialize(*column, buf);
+            RETURN_IF(buf == nullptr, Status::InternalError("serialize data error"));
+        }
+        entry.schemas.emplace_back(chunk->clone_empty(0));
+        entry.owner_ids.emplace_back(chunk->owner_info().owner_id());
+    }
+    size_t content_length = buf - begin;
+    entry.checksum = crc32c::Value(serialize_buffer.data(), content_length);
+
+    // 2. write serialized data to a new file
+    RETURN_IF_ERROR(_write_file(&entry, Slice(serialize_buffer.data(), content_length)));
+
+    // 3. replace the old entry, and evict entries in LRU order until the usage does not exceed capacity.
+    // the files of evicted entries are deleted outside the lock.
+    std::vector<Entry> released;
+    DeferOp delete_released([&]() { _delete_files(released); });
+    std::lock_guard l(_mutex);
+    // the key is invalidated or spilled again while the value is written, so the value is stale.
+    if (auto it = _pending_puts.find(key); it == _pending_puts.end() || it->second != ticket) {
+        released.emplace_back(std::move(entry));
+        return Status::OK();
+    }
+    if (auto it = _index.find(key); it != _index.end()) {
+        _erase_unlocked(it->second, &released);
+    }
+    while (!_lru.empty() && _usage + content_length > _capacity) {
+        _erase_unlocked(std::prev(_lru.end()), &released);
+    }
+    _usage += content_length;
+    _lru.emplace_front(std::move(entry));
+    _index[key] = _lru.begin();
+    return Status::OK();
+}
+
+Status DiskCacheTier::_write_file(Entry* entry, const Slice& data) {
+    const auto& dirs = _dir_mgr->dirs();
+    auto file_id = _next_file_id++;
+    entry->dir = dirs[file_id % dirs.size()];
+    entry->path = fmt::format("{}/{}", _tier_dir(*entry->dir), file_id);
+    auto* fs = entry->dir->fs();
+    WritableFileOptions opts;
+    opts.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE;
+    auto file = fs->new_writable_file(opts, entry->path);
+    if (file.status().is_not_found()) {
+        // the directory is removed by someone else, create it again.
+        RETURN_IF_ERROR(fs->create_dir_if_missing(_tier_dir(*entry->dir)));
+        file = fs->new_writable_file(opts, entry->path);
+    }
+    RETURN_IF_ERROR(file.status());
+    auto st = (*file)->append(data);
+    if (st.ok()) {
+        st = (*file)->close();
+    }
+    if (!st.ok()) {
+        WARN_IF_ERROR(fs->delete_file(entry->path), fmt::format("cannot delete query cache file: {}", entry->path));
+        return st;
+    }
+    entry->size = data.size;
+    return Status::OK();
+}
+
+StatusOr<CacheValue> DiskCacheTier::take(const std::string& key) {
+    ++_lookup_count;
+    std::vector<Entry> released;
+    // the file is deleted once it is read.
+    DeferOp delete_released([&]() { _delete_files(released); });
+    {
+        std::lock_guard l(_mutex);
+        auto it = _index.find(key);
+        if (it == _index.end()) {
+            return Status::NotFound("CacheMiss");
+        }
+        _erase_unlocked(it->second, &released);
+    }
+    const auto& entry = released.back();
+
+    raw::RawString buffer;
+    buffer.resize(entry.size);
+    ASSIGN_OR_RETURN(auto file, entry.dir->fs()->new_random_access_file(entry.path));
+    RETURN_IF_ERROR(file->read_at_fully(0, buffer.data(), entry.size));
+    file.reset();
+
+    if (crc32c::Value(buffer.data(), entry.size) != entry.checksum) {
+        return Status::Corruption("checksum mismatch of query cache entry spilled to disk");
+    }
+
+    const uint8_t* read_cursor = reinterpret_cast<const uint8_t*>(buffer.data());
+    CacheResult result;
+    result.reserve(entry.schemas.size());
+    for (size_t i = 0; i < entry.schemas.size(); ++i) {
+        ChunkPtr chunk = entry.schemas[i]->clone_empty(0);
+        for (auto& column : chunk->columns()) {
+            read_cursor = serde::ColumnArraySerde::deserialize(read_cursor, column.get());
+            RETURN_IF(read_cursor == nullptr, Status::InternalError("deserialize failed"));
+        }
+        chunk->owner_info().set_owner_id(entry.owner_ids[i], i + 1 == entry.schemas.size());
+        result.emplace_back(std::move(chunk));
+    }
+    ++_hit_count;
+    return CacheValue(entry.populate_time, entry.version, std::move(result));
+}
+
+void DiskCacheTier::erase(const std::string& key) {
+    std::vector<Entry> released;
+    {
+        std::lock_guard l(_mutex);
+        _pending_puts.erase(key);
+        if (auto it = _index.find(key); it != _index.end()) {
+            _erase_unlocked(it->second, &released);
+        }
+    }
+    _delete_files(released);
+}
+
+void DiskCacheTier::clear() {
+    std::vector<Entry> released;
+    {
+        std::lock_guard l(_mutex);
+        _pending_puts.clear();
+        while (!_lru.empty()) {
+            _erase_unlocked(_lru.begin(), &released);
+        }
+    }
+    _delete_files(released);
+}
+
+size_t DiskCacheTier::usage() const {
+    std::lock_guard l(_mutex);
+    return _usage;
+}
+
+void DiskCacheTier::_erase_unlocked(EntryList::iterator it, std::vector<Entry>* released) {
+    _usage -= it->size;
+    _index.erase(it->key);
+    released->emplace_back(std::move(*it));
+    _lru.erase(it);
+}
+
+void DiskCacheTier::_delete_files(const std::vector<Entry>& released) {
+    for (const auto& entry : released) {
+        WARN_IF_ERROR(entry.dir->fs()->delete_file(entry.path),
+                      fmt::format("cannot delete query cache file: {}", entry.path));
+    }
+}
+
+} // namespace starrocks::query_cache
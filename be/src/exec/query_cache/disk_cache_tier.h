@@ -0,0 +1,101 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "column/chunk.h"
+#include "common/status.h"
+#include "common/statusor.h"
+#include "exec/query_cache/cache_manager.h"
+#include "exec/spill/dir_manager.h"
+
+namespace starrocks::query_cache {
+
+// DiskCacheTier is the second tier of CacheManager, it keeps the cache values evicted from memory in local spill
+// directories. Each cache value is serialized into its own file under the sub-directory query_cache of a spill dir,
+// the file is deleted as soon as the entry is evicted from DiskCacheTier or promoted back to memory tier. The
+// sub-directory is owned by DiskCacheTier and never removed while it is alive, and the files are not counted in
+// the capacity of spill dirs used by query spilling. Entries are keyed in the same way as memory tier, evicted in
+// LRU order when the total size of files exceeds capacity, and verified by crc32c on read.
+class DiskCacheTier {
+public:
+    DiskCacheTier(spill::DirManager* dir_mgr, size_t capacity);
+    ~DiskCacheTier();
+
+    // Create the sub-directories, and delete the files left by the previous process.
+    Status init();
+
+    // Register a put of |key| which is done later by another thread, the returned ticket is passed to put. The put
+    // is discarded if the key is erased or the tier is cleared in between, or another put of the key is registered.
+    int64_t prepare_put(const std::string& key);
+    // Serialize the value and write it to disk, the old entry of the same key is replaced.
+    Status put(const std::string& key, const CacheValue& value, int64_t ticket);
+    Status put(const std::string& key, const CacheValue& value) { return put(key, value, prepare_put(key)); }
+    // Drop the registration of a put which will never be done.
+    void cancel_put(const std::string& key, int64_t ticket);
+    // Read the value from disk and remove it from DiskCacheTier.
+    StatusOr<CacheValue> take(const std::string& key);
+    void erase(const std::string& key);
+    void clear();
+
+    size_t usage() const;
+    size_t capacity() const { return _capacity; }
+    size_t lookup_count() const { return _lookup_count; }
+    size_t hit_count() const { return _hit_count; }
+
+private:
+    struct Entry {
+        std::string key;
+        int64_t populate_time;
+        int64_t version;
+        // empty chunks that keep column types and slot-id mapping used to deserialize chunks of the value.
+        std::vector<ChunkPtr> schemas;
+        std::vector<int64_t> owner_ids;
+        spill::DirPtr dir;
+        std::string path;
+        size_t size = 0;
+        uint32_t checksum;
+    };
+    using EntryList = std::list<Entry>;
+
+    std::string _tier_dir(const spill::Dir& dir) const;
+    Status _write_file(Entry* entry, const Slice& data);
+    void _erase_unlocked(EntryList::iterator it, std::vector<Entry>* released);
+    static void _delete_files(const std::vector<Entry>& released);
+
+    spill::DirManager* _dir_mgr;
+    const size_t _capacity;
+    std::atomic<uint64_t> _next_file_id{0};
+
+    mutable std::mutex _mutex;
+    // the most recently used entry is at the front.
+    EntryList _lru;
+    std::unordered_map<std::string, EntryList::iterator> _index;
+    size_t _usage = 0;
+    // the ticket of the latest registered put of each key which is not finished yet.
+    std::unordered_map<std::string, int64_t> _pending_puts;
+    int64_t _next_ticket = 0;
+
+    std::atomic<size_t> _lookup_count{0};
+    std::atomic<size_t> _hit_count{0};
+};
+
+} // namespace starrocks::query_cache
@@ -17,6 +17,8 @@
 
 #include "exec/short_circuit_hybrid.h"
 
+#include <numeric>
+
 #include "column/column_helper.h"
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -187,41 +189,49 @@ Status ShortCircuitHybridScanNode::_process_value_chunk(std::vector<bool>& found
     std::vector<int> key_idx_to_value_idx(_num_rows, -1);
     int value_chunk_idx = 0;
 
-    for (int i = 0; i < _tablets.size(); ++i) {
+    // keys found in a tablet are not searched in the following tablets, so each key is probed in primary index
+    // only once when all the keys are found in the first tablets.
+    std::vector<uint32_t> remaining_key_idxes(_num_rows);
+    std::iota(remaining_key_idxes.begin(), remaining_key_idxes.end(), 0);
+    for (int i = 0; i < _tablets.size() && !remaining_key_idxes.empty(); ++i) {
         LocalTableReaderParams params;
         params.version = std::stoi(_versions[i]);
         params.tablet_id = _tablets[i]->get_tablet_info().tablet_id;
         _table_reader = std::make_shared<TableReader>();
         RETURN_IF_ERROR(_table_reader->init(params));
 
-        auto current_chunk = ChunkHelper::new_chunk(*(value_schema), _num_rows);
+        ChunkPtr keys = _key_chunk;
+        if (remaining_key_idxes.size() != _num_rows) {
+            keys = _key_chunk->clone_empty(remaining_key_idxes.size());
+            keys->append_selective(*_key_chunk, remaining_key_idxes.data(), 0, remaining_key_idxes.size());
+        }
+        auto current_chunk = ChunkHelper::new_chunk(*(value_schema), remaining_key_idxes.size());
         // current tablet will return all key_chunk mapping whether has value
         // true , means vector idx of key_chunk have value
         std::vector<bool> curent_found;
-        Status status =
-                _table_reader->multi_get(*(_key_chunk.get()), value_field_names, curent_found, *(current_chunk.get()));
+        Status status = _table_reader->multi_get(*keys, value_field_names, curent_found, *(current_chunk.get()));
         if (!status.ok()) {
             // todo retry
             LOG(WARNING) << "fail to execute multi get: " << status.detailed_message();
+            continue;
         }
 
         // merge all tablet result
         bool has_found_value = false;
-        for (int key_idx = 0; key_idx < curent_found.size(); ++key_idx) {
-            // 1 tablet will have many value hit predicate, so here need foreach end
-            if (curent_found[key_idx] && key_idx_to_value_idx[key_idx] == -1) {
-                // make sure found order is same between key_chunk and value_chunk
-                key_idx_to_value_idx[key_idx] = value_chunk_idx;
-                value_chunk_idx++;
-                if (UNLIKELY(found[key_idx])) {
-                    return Status::Corruption(
-                            fmt::format("one key can't be found twice in short circuit, tablet_id: {}, key_idx: {}",
-                                        params.tablet_id, key_idx));
-                }
-                found[key_idx] = true;
-                has_found_value = true;
+        std::vector<uint32_t> next_remaining_key_idxes;
+        for (int j = 0; j < curent_found.size(); ++j) {
+            auto key_idx = remaining_key_idxes[j];
+            if (!curent_found[j]) {
+                next_remaining_key_idxes.push_back(key_idx);
+                continue;
             }
+            // make sure found order is same between key_chunk and value_chunk
+            key_idx_to_value_idx[key_idx] = value_chunk_idx;
+            value_chunk_idx++;
+            found[key_idx] = true;
+            has_found_value = true;
         }
+        remaining_key_idxes.swap(next_remaining_key_idxes);
         if (has_found_value) {
             value_chunk->append(*(current_chunk.get()));
         }
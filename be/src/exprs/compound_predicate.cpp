@@ -14,8 +14,12 @@
 
 #include "exprs/compound_predicate.h"
 
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exprs/binary_function.h"
+#include "exprs/column_ref.h"
+#include "exprs/like_predicate.h"
+#include "exprs/literal.h"
 #include "exprs/predicate.h"
 #include "exprs/unary_function.h"
 #include "runtime/runtime_state.h"
@@ -128,7 +132,22 @@ DEFINE_BINARY_FUNCTION_WITH_IMPL(OrImpl, l_value, r_value) {
 class VectorizedOrCompoundPredicate final : public Predicate {
 public:
     DEFINE_COMPOUND_CONSTRUCT(VectorizedOrCompoundPredicate);
+
+    Status open(RuntimeState* state, ExprContext* context, FunctionContext::FunctionStateScope scope) override {
+        // fuse before opening the children, so the nested OR predicates of a fused chain don't compile again
+        if (scope == FunctionContext::FRAGMENT_LOCAL && config::enable_multi_pattern_like_predicate &&
+            !_fused_by_parent && _like_matcher == nullptr) {
+            _fuse_like_predicates();
+        }
+        return Expr::open(state, context, scope);
+    }
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
+        if (_like_matcher != nullptr) {
+            ASSIGN_OR_RETURN(auto value, _like_column->evaluate_checked(context, ptr));
+            return _like_matcher->match(value);
+        }
+
         ASSIGN_OR_RETURN(auto l, _children[0]->evaluate_checked(context, ptr));
 
         int l_trues = ColumnHelper::count_true_with_notnull(l);
@@ -189,6 +208,66 @@ public:
             << ", rhs_is_constant=" << _children[1]->is_constant() << ", expr (" << expr_debug_string << ") )";
         return out.str();
     }
+
+private:
+    // If the operands of this OR chain are all LIKE / REGEXP predicates with constant patterns on one column,
+    // e.g. `a LIKE '%x%' OR a REGEXP 'y.*z' OR a LIKE 'w_'`, evaluates them by one multi-pattern matcher.
+    void _fuse_like_predicates() {
+        Expr* column = nullptr;
+        std::vector<MultiPatternMatcher::Pattern> patterns;
+        std::vector<VectorizedOrCompoundPredicate*> chain;
+        if (!_collect_like_predicates(this, &column, &patterns, &chain)) {
+            return;
+        }
+        auto matcher = MultiPatternMatcher::create(patterns);
+        if (!matcher.ok()) {
+            VLOG(2) << "evaluate LIKE predicates one by one: " << matcher.status().message();
+            return;
+        }
+        _like_matcher = std::move(matcher).value();
+        _like_column = column;
+        for (auto* predicate : chain) {
+            predicate->_fused_by_parent = (predicate != this);
+        }
+    }
+
+    static bool _collect_like_predicates(Expr* expr, Expr** column, std::vector<MultiPatternMatcher::Pattern>* patterns,
+                                         std::vector<VectorizedOrCompoundPredicate*>* chain) {
+        if (auto* predicate = dynamic_cast<VectorizedOrCompoundPredicate*>(expr); predicate != nullptr) {
+            chain->emplace_back(predicate);
+            return _collect_like_predicates(expr->get_child(0), column, patterns, chain) &&
+                   _collect_like_predicates(expr->get_child(1), column, patterns, chain);
+        }
+
+        if (expr->node_type() != TExprNodeType::FUNCTION_CALL || expr->get_num_children() != 2) {
+            return false;
+        }
+        const auto& fn_name = expr->fn().name.function_name;
+        if (fn_name != "like" && fn_name != "regexp") {
+            return false;
+        }
+        auto* value = dynamic_cast<ColumnRef*>(expr->get_child(0));
+        auto* pattern = dynamic_cast<VectorizedLiteral*>(expr->get_child(1));
+        if (value == nullptr || !value->type().is_string_type() || pattern == nullptr ||
+            pattern->value()->only_null()) {
+            return false;
+        }
+        if (*column == nullptr) {
+            *column = value;
+        } else if (down_cast<ColumnRef*>(*column)->slot_id() != value->slot_id()) {
+            return false;
+        }
+        // like has no ESCAPE argument, its patterns are escaped by '\\' as in the single predicate
+        auto pattern_value = ColumnHelper::get_const_value<TYPE_VARCHAR>(pattern->value());
+        patterns->push_back({pattern_value.to_string(), fn_name == "like", '\\'});
+        return true;
+    }
+
+    std::shared_ptr<MultiPatternMatcher> _like_matcher;
+    // the column matched by _like_matcher
+    Expr* _like_column = nullptr;
+    // this chain is evaluated by the fused parent
+    bool _fused_by_parent = false;
 };
 
 DEFINE_UNARY_FN_WITH_IMPL(CompoundPredNot, l) {
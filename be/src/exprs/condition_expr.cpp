@@ -14,6 +14,8 @@
 
 #include "exprs/condition_expr.h"
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -30,6 +32,11 @@
 #include "util/dispatch.h"
 #include "util/percentile_value.h"
 
+#ifdef STARROCKS_JIT_ENABLE
+#include "exprs/jit/ir_helper.h"
+#include "runtime/runtime_state.h"
+#endif
+
 namespace starrocks {
 
 template <bool isConstC0, bool isConst1, LogicalType Type>
@@ -64,6 +71,22 @@ struct SelectIfOP {
     }
 };
 
+#ifdef STARROCKS_JIT_ENABLE
+// Whether the children from |from| are all of |type|, so that their values can be selected from one another in IR.
+static bool children_of_type(const std::vector<Expr*>& children, size_t from, LogicalType type) {
+    return std::all_of(children.begin() + from, children.end(),
+                       [type](const Expr* child) { return child->type().type == type; });
+}
+
+static std::string jit_children_name(RuntimeState* state, const std::vector<Expr*>& children) {
+    std::string name;
+    for (size_t i = 0; i < children.size(); i++) {
+        name += (i > 0 ? "," : "") + children[i]->jit_func_name(state);
+    }
+    return name;
+}
+#endif
+
 #define DEFINE_CLASS_CONSTRUCT_FN(NAME)         \
     NAME(const TExprNode& node) : Expr(node) {} \
                                                 \
@@ -76,6 +99,29 @@ class VectorizedIfNullExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIfNullExpr);
 
+#ifdef STARROCKS_JIT_ENABLE
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CASE) && IRHelper::support_jit(Type) &&
+               children_of_type(_children, 0, Type);
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{ifnull(" + jit_children_name(state, _children) + ")}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(auto lhs, _children[0]->generate_ir(context, jit_ctx))
+        ASSIGN_OR_RETURN(auto rhs, _children[1]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        auto* lhs_is_null = IRHelper::bool_to_cond(b, lhs.null_flag);
+        LLVMDatum result(b);
+        result.value = b.CreateSelect(lhs_is_null, rhs.value, lhs.value);
+        result.null_flag = b.CreateSelect(lhs_is_null, rhs.null_flag, lhs.null_flag);
+        return result;
+    }
+#endif
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(auto lhs, _children[0]->evaluate_checked(context, ptr));
 
@@ -146,6 +192,35 @@ class VectorizedNullIfExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedNullIfExpr);
 
+#ifdef STARROCKS_JIT_ENABLE
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CASE) && IRHelper::support_jit(Type) &&
+               children_of_type(_children, 0, Type);
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{nullif(" + jit_children_name(state, _children) + ")}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(auto lhs, _children[0]->generate_ir(context, jit_ctx))
+        ASSIGN_OR_RETURN(auto rhs, _children[1]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        llvm::Value* equal = nullptr;
+        if constexpr (lt_is_float<Type>) {
+            equal = b.CreateFCmpOEQ(lhs.value, rhs.value);
+        } else {
+            equal = b.CreateICmpEQ(lhs.value, rhs.value);
+        }
+        auto* any_null = IRHelper::bool_to_cond(b, b.CreateOr(lhs.null_flag, rhs.null_flag));
+        LLVMDatum result(b);
+        result.value = lhs.value;
+        result.null_flag = b.CreateSelect(b.CreateAnd(b.CreateNot(any_null), equal), b.getInt8(1), lhs.null_flag);
+        return result;
+    }
+#endif
+
     // NullIF: return null if lhs == rhs else return lhs
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(auto lhs, _children[0]->evaluate_checked(context, ptr));
@@ -221,6 +296,32 @@ class VectorizedIfExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIfExpr);
 
+#ifdef STARROCKS_JIT_ENABLE
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CASE) && IRHelper::support_jit(Type) &&
+               _children[0]->type().type == TYPE_BOOLEAN && children_of_type(_children, 1, Type);
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{if(" + jit_children_name(state, _children) + ")}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
+    // a null condition selects the else branch
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(auto bhs, _children[0]->generate_ir(context, jit_ctx))
+        ASSIGN_OR_RETURN(auto lhs, _children[1]->generate_ir(context, jit_ctx))
+        ASSIGN_OR_RETURN(auto rhs, _children[2]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        auto* cond = b.CreateAnd(IRHelper::bool_to_cond(b, bhs.value),
+                                 b.CreateNot(IRHelper::bool_to_cond(b, bhs.null_flag)));
+        LLVMDatum result(b);
+        result.value = b.CreateSelect(cond, lhs.value, rhs.value);
+        result.null_flag = b.CreateSelect(cond, lhs.null_flag, rhs.null_flag);
+        return result;
+    }
+#endif
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(auto bhs, _children[0]->evaluate_checked(context, ptr));
         const int true_count = ColumnHelper::count_true_with_notnull(bhs);
@@ -375,6 +476,34 @@ class VectorizedCoalesceExpr : public Expr {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedCoalesceExpr);
 
+#ifdef STARROCKS_JIT_ENABLE
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::CASE) && IRHelper::support_jit(Type) &&
+               children_of_type(_children, 0, Type);
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{coalesce(" + jit_children_name(state, _children) + ")}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
+    // selects from the last child to the first one, so the first not null child wins
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        std::vector<LLVMDatum> datums(_children.size());
+        for (size_t i = 0; i < _children.size(); i++) {
+            ASSIGN_OR_RETURN(datums[i], _children[i]->generate_ir(context, jit_ctx))
+        }
+        auto& b = jit_ctx->builder;
+        LLVMDatum result = datums.back();
+        for (size_t i = datums.size() - 1; i > 0; i--) {
+            auto* is_null = IRHelper::bool_to_cond(b, datums[i - 1].null_flag);
+            result.value = b.CreateSelect(is_null, result.value, datums[i - 1].value);
+            result.null_flag = b.CreateSelect(is_null, result.null_flag, datums[i - 1].null_flag);
+        }
+        return result;
+    }
+#endif
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         Columns columns;
         for (int i = 0; i < _children.size(); ++i) {
@@ -119,6 +119,9 @@ public:
     bool is_nullable() const { return _is_nullable; }
 
     bool is_monotonic() const { return _is_monotonic; }
+    // Not empty if the result of this expr can be shared by the ExprContexts evaluating the same chunk, set in
+    // prepare. See SubExprCache.
+    const std::string& memo_key() const { return _memo_key; }
     bool is_cast_expr() const { return _node_type == TExprNodeType::CAST_EXPR; }
     virtual bool is_lambda_function() const { return false; }
     virtual bool is_literal() const { return false; }
@@ -346,6 +349,10 @@ protected:
     // In storage engine, Is this expr only used for index filter(so expr filter phase will skip this expr). This info is passed from FE
     bool _is_index_only_filter = false;
 
+    // The key of this expr in SubExprCache. It's not copied by `Expr::Expr(const Expr&)`, because the children of a
+    // cloned expr may be replaced, and the clone computes its own key when it's prepared.
+    std::string _memo_key;
+
     // analysis is done, types are fixed at this point
     TypeDescriptor _type;
     std::vector<Expr*> _children = std::vector<Expr*>();
@@ -22,6 +22,7 @@
 #include "column/vectorized_fwd.h"
 #include "exprs/builtin_functions.h"
 #include "exprs/expr_context.h"
+#include "exprs/sub_expr_cache.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
 #include "runtime/user_function_cache.h"
@@ -115,6 +116,8 @@ Status VectorizedFunctionCallExpr::prepare(starrocks::RuntimeState* state, starr
                                  _fn.fid == 10302 /* rand */ || _fn.fid == 10303 /* random */ ||
                                  _fn.fid == 100015 /* uuid */ || _fn.fid == 100016 /* uniq_id */;
 
+    _memo_key = SubExprCache::fingerprint(this);
+
     return Status::OK();
 }
 
@@ -181,6 +184,14 @@ bool VectorizedFunctionCallExpr::is_constant() const {
 }
 
 StatusOr<ColumnPtr> VectorizedFunctionCallExpr::evaluate_checked(starrocks::ExprContext* context, Chunk* ptr) {
+    // looked up here rather than by the caller, so that a shared call is reused under any parent expr
+    if (SubExprCache* cache = SubExprCache::current(); cache != nullptr && !_memo_key.empty()) {
+        return cache->evaluate(this, ptr, [&]() { return _evaluate(context, ptr); });
+    }
+    return _evaluate(context, ptr);
+}
+
+StatusOr<ColumnPtr> VectorizedFunctionCallExpr::_evaluate(ExprContext* context, Chunk* ptr) {
     FunctionContext* fn_ctx = context->fn_context(_fn_context_index);
 
     Columns args;
@@ -33,6 +33,8 @@ public:
 
     const FunctionDescriptor* get_function_desc() { return _fn_desc; }
 
+    bool is_returning_random_value() const { return _is_returning_random_value; }
+
     bool support_ngram_bloom_filter(ExprContext* context) const override;
     bool ngram_bloom_filter(ExprContext* context, const BloomFilter* bf,
                             const NgramBloomFilterReaderOptions& reader_options) const override;
@@ -55,6 +57,8 @@ protected:
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override;
 
 private:
+    StatusOr<ColumnPtr> _evaluate(ExprContext* context, Chunk* ptr);
+
     const FunctionDescriptor* _get_function_by_fid(const TFunction& fn);
     const FunctionDescriptor* _get_function(const TFunction& fn, const std::vector<TypeDescriptor>& arg_types,
                                             const TypeDescriptor& result_type, std::vector<bool> arg_nullables);
@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -28,6 +30,11 @@
 #include "runtime/types.h"
 #include "simd/simd.h"
 
+#ifdef STARROCKS_JIT_ENABLE
+#include "exprs/jit/ir_helper.h"
+#include "runtime/runtime_state.h"
+#endif
+
 namespace starrocks {
 
 class RuntimeState;
@@ -182,6 +189,57 @@ public:
         return Status::OK();
     }
 
+#ifdef STARROCKS_JIT_ENABLE
+    // Only a small IN list of constants is compiled, into the comparisons with each value, which LLVM turns into a
+    // switch or a bit test. A large one is left to the hash set.
+    static constexpr size_t MAX_JIT_IN_LIST_SIZE = 64;
+
+    bool is_compilable(RuntimeState* state) const override {
+        if (!state->can_jit_expr(CompilableExprType::CMP) || !IRHelper::support_jit(Type) || _eq_null ||
+            _is_join_runtime_filter || _children.size() < 2 || _children.size() > MAX_JIT_IN_LIST_SIZE + 1 ||
+            _children[0]->type().type != Type) {
+            return false;
+        }
+        return std::all_of(_children.begin() + 1, _children.end(), [state](const Expr* child) {
+            return child->type().type == Type && child->is_constant() && child->is_compilable(state);
+        });
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        std::string name = "{" + _children[0]->jit_func_name(state) + (_is_not_in ? " not in(" : " in(");
+        for (size_t i = 1; i < _children.size(); i++) {
+            name += (i > 1 ? "," : "") + _children[i]->jit_func_name(state);
+        }
+        return name + ")}" + (is_constant() ? "c:" : "") + (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(auto lhs, _children[0]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        llvm::Value* found = b.getFalse();
+        llvm::Value* null_in_set = b.getFalse();
+        for (size_t i = 1; i < _children.size(); i++) {
+            ASSIGN_OR_RETURN(auto datum, _children[i]->generate_ir(context, jit_ctx))
+            auto* is_null = IRHelper::bool_to_cond(b, datum.null_flag);
+            llvm::Value* equal = nullptr;
+            if constexpr (lt_is_float<Type>) {
+                equal = b.CreateFCmpOEQ(lhs.value, datum.value);
+            } else {
+                equal = b.CreateICmpEQ(lhs.value, datum.value);
+            }
+            found = b.CreateOr(found, b.CreateAnd(b.CreateNot(is_null), equal));
+            null_in_set = b.CreateOr(null_in_set, is_null);
+        }
+        LLVMDatum result(b);
+        result.value = b.CreateZExt(_is_not_in ? b.CreateNot(found) : found, b.getInt8Ty());
+        // null if lhs is null, or lhs is not found in a set containing null
+        auto* is_null =
+                b.CreateOr(IRHelper::bool_to_cond(b, lhs.null_flag), b.CreateAnd(b.CreateNot(found), null_in_set));
+        result.null_flag = b.CreateZExt(is_null, b.getInt8Ty());
+        return result;
+    }
+#endif
+
     template <bool use_array>
     ColumnPtr eval_on_chunk_both_column_and_set_not_has_null(const ColumnPtr& lhs, uint8_t* filter) {
         DCHECK(!_null_in_set);
@@ -20,6 +20,11 @@
 #include "exprs/unary_function.h"
 #include "types/logical_type.h"
 
+#ifdef STARROCKS_JIT_ENABLE
+#include "exprs/jit/ir_helper.h"
+#include "runtime/runtime_state.h"
+#endif
+
 namespace starrocks {
 
 #define DEFINE_CLASS_CONSTRUCT_FN(NAME)              \
@@ -37,6 +42,25 @@ class VectorizedIsNullPredicate final : public Predicate {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIsNullPredicate);
 
+#ifdef STARROCKS_JIT_ENABLE
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::LOGICAL) && IRHelper::support_jit(_children[0]->type().type);
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{is_null:" + _children[0]->jit_func_name(state) + "}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(auto datum, _children[0]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        LLVMDatum result(b);
+        result.value = datum.null_flag;
+        return result;
+    }
+#endif
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(ColumnPtr column, _children[0]->evaluate_checked(context, ptr));
 
@@ -72,6 +96,25 @@ class VectorizedIsNotNullPredicate final : public Predicate {
 public:
     DEFINE_CLASS_CONSTRUCT_FN(VectorizedIsNotNullPredicate);
 
+#ifdef STARROCKS_JIT_ENABLE
+    bool is_compilable(RuntimeState* state) const override {
+        return state->can_jit_expr(CompilableExprType::LOGICAL) && IRHelper::support_jit(_children[0]->type().type);
+    }
+
+    std::string jit_func_name_impl(RuntimeState* state) const override {
+        return "{is_not_null:" + _children[0]->jit_func_name(state) + "}" + (is_constant() ? "c:" : "") +
+               (is_nullable() ? "n:" : "") + type().debug_string();
+    }
+
+    StatusOr<LLVMDatum> generate_ir_impl(ExprContext* context, JITContext* jit_ctx) override {
+        ASSIGN_OR_RETURN(auto datum, _children[0]->generate_ir(context, jit_ctx))
+        auto& b = jit_ctx->builder;
+        LLVMDatum result(b);
+        result.value = b.CreateXor(datum.null_flag, b.getInt8(1));
+        return result;
+    }
+#endif
+
     StatusOr<ColumnPtr> evaluate_checked(ExprContext* context, Chunk* ptr) override {
         ASSIGN_OR_RETURN(ColumnPtr column, _children[0]->evaluate_checked(context, ptr));
 
@@ -16,6 +16,7 @@
 
 #include <fmt/format.h>
 #include <glog/logging.h>
+#include <llvm/ADT/SmallString.h>
 #include <llvm/Analysis/Passes.h>
 #include <llvm/Analysis/TargetTransformInfo.h>
 #include <llvm/Bitcode/BitcodeReader.h>
@@ -35,8 +36,10 @@
 #include <llvm/Passes/PassBuilder.h>
 #include <llvm/Passes/PassPlugin.h>
 #include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
 #include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Transforms/IPO.h>
@@ -54,9 +57,11 @@
 #include <llvm/Transforms/Vectorize/LoopVectorize.h>
 #include <llvm/Transforms/Vectorize/SLPVectorizer.h>
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include "common/compiler_util.h"
 #include "common/config.h"
@@ -64,7 +69,9 @@
 #include "exprs/expr.h"
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
+#include "util/debug_util.h"
 #include "util/defer_op.h"
+#include "util/hash_util.hpp"
 #include "util/mem_info.h"
 
 namespace starrocks {
@@ -151,6 +158,17 @@ Status JITEngine::init() {
     _func_cache = new_lru_cache(jit_lru_cache_size);
 #endif
     DCHECK(_func_cache != nullptr);
+    if (!config::jit_object_cache_dir.empty()) {
+        std::error_code ec;
+        for (llvm::sys::fs::directory_iterator it(config::jit_object_cache_dir, ec), end; it != end && !ec;
+             it.increment(ec)) {
+            if (llvm::sys::path::extension(it->path()) == ".o") {
+                _num_persisted_objects++;
+            }
+        }
+        LOG(INFO) << "JIT object cache dir = " << config::jit_object_cache_dir
+                  << ", persisted objects = " << _num_persisted_objects.load();
+    }
     llvm::InitializeNativeTarget();
     llvm::InitializeNativeTargetAsmPrinter();
     llvm::InitializeNativeTargetAsmParser();
@@ -173,21 +191,167 @@ Status JITEngine::compile_scalar_function(ExprContext* context, JitObjectCache*
         return Status::OK();
     }
 
+    const auto& func_name = func_cache->get_func_name();
     ASSIGN_OR_RETURN(auto engine, Engine::create(*func_cache))
-    // TODO: check need set module?
-    // generate ir to module
-    RETURN_IF_ERROR(generate_scalar_function_ir(context, *engine->module(), expr, uncompilable_exprs, func_cache));
-    // optimize module and add module
-    RETURN_IF_ERROR(engine->optimize_and_finalize_module());
+    // the object code persisted by a previous BE process skips both IR generation and compilation
+    auto persisted = instance->load_persisted_object(func_name);
+    const bool is_persisted = persisted != nullptr;
+    if (is_persisted) {
+        // the object cache is not notified for an added object file
+        func_cache->notifyObjectCompiled(nullptr, persisted->getMemBufferRef());
+        auto st = engine->add_object(std::move(persisted));
+        if (!st.ok()) {
+            // the object file is corrupted, compile it again next time
+            instance->remove_persisted_object(func_name);
+            return st;
+        }
+        instance->_num_loaded_persisted_objects++;
+    } else {
+        // TODO: check need set module?
+        // generate ir to module
+        RETURN_IF_ERROR(generate_scalar_function_ir(context, *engine->module(), expr, uncompilable_exprs, func_cache));
+        // optimize module and add module
+        RETURN_IF_ERROR(engine->optimize_and_finalize_module());
+    }
     cached = instance->lookup_function(func_cache);
     if (cached) {
         return Status::OK();
     }
-    ASSIGN_OR_RETURN(auto function, engine->get_compiled_func(func_cache->get_func_name()));
-    RETURN_IF_ERROR(func_cache->register_func(function));
+    auto function = engine->get_compiled_func(func_name);
+    if (!function.ok()) {
+        if (is_persisted) {
+            // the object file is corrupted, compile it again next time
+            instance->remove_persisted_object(func_name);
+        }
+        return function.status();
+    }
+    RETURN_IF_ERROR(func_cache->register_func(function.value()));
+    if (!is_persisted) {
+        instance->persist_object(func_name, *func_cache->get_obj_code());
+    }
     return Status::OK();
 }
 
+std::string JITEngine::_persisted_object_path(const std::string& func_name) {
+    // the object code depends on the code generating IR and the target
+    static const std::string salt = get_short_version() + "/" + llvm::sys::getDefaultTargetTriple() + "/";
+    std::string key = salt + func_name;
+    uint64_t hash = HashUtil::xx_hash3_64(key.data(), static_cast<int32_t>(key.size()), 0);
+    return fmt::format("{}/{:016x}.o", config::jit_object_cache_dir, hash);
+}
+
+// The persisted file is the size of the function name, the function name, and then the object code. The function
+// name tells the hash collisions apart.
+std::unique_ptr<llvm::MemoryBuffer> JITEngine::load_persisted_object(const std::string& func_name) const {
+    if (config::jit_object_cache_dir.empty()) {
+        return nullptr;
+    }
+    auto file = llvm::MemoryBuffer::getFile(_persisted_object_path(func_name));
+    if (!file) {
+        return nullptr;
+    }
+    llvm::StringRef data = (*file)->getBuffer();
+    uint32_t name_size = 0;
+    if (data.size() < sizeof(name_size)) {
+        return nullptr;
+    }
+    memcpy(&name_size, data.data(), sizeof(name_size));
+    data = data.drop_front(sizeof(name_size));
+    if (data.size() <= name_size || data.take_front(name_size) != func_name) {
+        return nullptr;
+    }
+    return llvm::MemoryBuffer::getMemBufferCopy(data.drop_front(name_size), func_name);
+}
+
+void JITEngine::persist_object(const std::string& func_name, const llvm::MemoryBuffer& obj_code) {
+    if (config::jit_object_cache_dir.empty() || config::jit_object_cache_max_files <= 0) {
+        return;
+    }
+    if (_num_persisted_objects >= config::jit_object_cache_max_files) {
+        _evict_persisted_objects();
+    }
+    auto path = _persisted_object_path(func_name);
+    auto ec = llvm::sys::fs::create_directories(config::jit_object_cache_dir);
+    int fd = -1;
+    llvm::SmallString<128> tmp_path;
+    if (!ec) {
+        // write a temporary file and rename it, so that a concurrent reader never sees a partial file
+        ec = llvm::sys::fs::createUniqueFile(path + "-%%%%%%.tmp", fd, tmp_path);
+    }
+    if (ec) {
+        LOG(WARNING) << "JIT failed to persist object of " << func_name << ": " << ec.message();
+        return;
+    }
+    {
+        llvm::raw_fd_ostream out(fd, /*shouldClose=*/true);
+        auto name_size = static_cast<uint32_t>(func_name.size());
+        out.write(reinterpret_cast<const char*>(&name_size), sizeof(name_size));
+        out << func_name << obj_code.getBuffer();
+        out.close();
+        if (out.has_error()) {
+            ec = out.error();
+            out.clear_error();
+        }
+    }
+    // a concurrent compile of the same function may have persisted it already, the rename replaces the file
+    const bool replaced = llvm::sys::fs::exists(path);
+    if (!ec) {
+        ec = llvm::sys::fs::rename(tmp_path, path);
+    }
+    if (ec) {
+        LOG(WARNING) << "JIT failed to persist object of " << func_name << ": " << ec.message();
+        llvm::sys::fs::remove(tmp_path);
+        return;
+    }
+    if (!replaced) {
+        _num_persisted_objects++;
+    }
+}
+
+void JITEngine::remove_persisted_object(const std::string& func_name) {
+    if (config::jit_object_cache_dir.empty()) {
+        return;
+    }
+    if (!llvm::sys::fs::remove(_persisted_object_path(func_name), /*IgnoreNonExisting=*/false)) {
+        _num_persisted_objects--;
+    }
+}
+
+// Removes the least recently written object files, so that the directory keeps at most 90% of
+// config::jit_object_cache_max_files and the next evictions are not triggered by each persisted object.
+void JITEngine::_evict_persisted_objects() {
+    std::lock_guard<std::mutex> lock(_evict_mutex);
+    const int64_t max_files = config::jit_object_cache_max_files;
+    if (_num_persisted_objects < max_files) {
+        // evicted by a concurrent persist
+        return;
+    }
+    std::vector<std::pair<llvm::sys::TimePoint<>, std::string>> files;
+    std::error_code ec;
+    for (llvm::sys::fs::directory_iterator it(config::jit_object_cache_dir, ec), end; it != end && !ec;
+         it.increment(ec)) {
+        if (llvm::sys::path::extension(it->path()) != ".o") {
+            continue;
+        }
+        auto status = it->status();
+        if (status) {
+            files.emplace_back(status->getLastModificationTime(), it->path());
+        }
+    }
+    // the count may drift from the directory, e.g. the files removed by hand, so it's reset by the scan
+    int64_t num_files = static_cast<int64_t>(files.size());
+    const int64_t target = max_files - std::max<int64_t>(1, max_files / 10);
+    if (num_files > target) {
+        std::sort(files.begin(), files.end());
+        for (size_t i = 0; i < files.size() && num_files > target; ++i) {
+            if (!llvm::sys::fs::remove(files[i].second)) {
+                num_files--;
+            }
+        }
+    }
+    _num_persisted_objects = num_files;
+}
+
 std::string JITEngine::dump_module_ir(const llvm::Module& module) {
     std::string ir;
     llvm::raw_string_ostream stream(ir);
@@ -440,6 +604,15 @@ Status JITEngine::Engine::optimize_and_finalize_module() {
     return Status::OK();
 }
 
+Status JITEngine::Engine::add_object(std::unique_ptr<llvm::MemoryBuffer> obj_code) {
+    auto err = _lljit->addObjectFile(std::move(obj_code));
+    if (err) {
+        return Status::JitCompileError("Failed to add object to LLJIT: " + llvm::toString(std::move(err)));
+    }
+    _module_finalized = true;
+    return Status::OK();
+}
+
 StatusOr<JITScalarFunction> JITEngine::Engine::get_compiled_func(const std::string& function) {
     if (!_module_finalized) {
         return Status::JitCompileError("module must be finalized before getting compiled function");
@@ -21,6 +21,7 @@
 #include <llvm/IR/IRBuilder.h>
 #include <llvm/Transforms/IPO/PassManagerBuilder.h>
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -57,6 +58,8 @@ public:
 
     size_t get_code_size() const { return _obj_code == nullptr ? 0 : _obj_code->getBufferSize(); }
 
+    const std::shared_ptr<llvm::MemoryBuffer>& get_obj_code() const { return _obj_code; }
+
 private:
     const std::string _cache_key;
     JITScalarFunction _func = nullptr;
@@ -104,7 +107,23 @@ public:
 
     static std::string dump_module_ir(const llvm::Module& module);
 
+    // Loads the object code of |func_name| persisted in config::jit_object_cache_dir, returns nullptr if not found.
+    std::unique_ptr<llvm::MemoryBuffer> load_persisted_object(const std::string& func_name) const;
+
+    // Persists the object code of |func_name| into config::jit_object_cache_dir, so that it is loaded instead of
+    // compiled again after BE restarts. The oldest object files are evicted once config::jit_object_cache_max_files
+    // is reached. Failures are only logged.
+    void persist_object(const std::string& func_name, const llvm::MemoryBuffer& obj_code);
+
+    // Removes the object file of |func_name|, e.g. a corrupted one, so that it's compiled again next time.
+    void remove_persisted_object(const std::string& func_name);
+
 private:
+    static std::string _persisted_object_path(const std::string& func_name);
+
+    // Evicts the oldest object files once config::jit_object_cache_max_files is reached.
+    void _evict_persisted_objects();
+
     // make an engine instance for each time of JIT
     class Engine {
     public:
@@ -120,6 +139,9 @@ private:
 
         Status optimize_and_finalize_module();
 
+        // Adds the object code compiled before instead of a module.
+        Status add_object(std::unique_ptr<llvm::MemoryBuffer> obj_code);
+
         StatusOr<JITScalarFunction> get_compiled_func(const std::string& function);
 
     private:
@@ -137,6 +159,11 @@ private:
     bool _initialized = false;
     bool _support_jit = false;
     Cache* _func_cache;
+    // the number of object files in config::jit_object_cache_dir
+    std::atomic<int64_t> _num_persisted_objects{0};
+    // the number of functions loaded from the object files instead of compiled
+    std::atomic<int64_t> _num_loaded_persisted_objects{0};
+    std::mutex _evict_mutex;
 };
 
 } // namespace starrocks
@@ -16,11 +16,13 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "exprs/binary_function.h"
 #include "glog/logging.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/Volnitsky.h"
 #include "util/defer_op.h"
+#include "util/lru_cache.h"
 
 namespace starrocks {
 
@@ -44,25 +46,163 @@ static const re2::RE2 LIKE_STARTS_WITH_RE(R"((((\\%)|(\\_)|([^%_]))+)(?:%+))", r
 static const re2::RE2 LIKE_EQUALS_RE(R"((((\\%)|(\\_)|([^%_]))+))", re2::RE2::Quiet);
 static const char* PROMPT_INFO = " so we switch to use re2.";
 
+static constexpr unsigned int HS_LIKE_FLAGS = HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH;
+
+HyperscanDatabaseCache* HyperscanDatabaseCache::instance() {
+    static HyperscanDatabaseCache cache;
+    return &cache;
+}
+
+HyperscanDatabaseCache::HyperscanDatabaseCache() : _cache(new_lru_cache(config::hyperscan_database_cache_size)) {}
+
+HyperscanDatabaseCache::~HyperscanDatabaseCache() = default;
+
+StatusOr<HyperscanDatabasePtr> HyperscanDatabaseCache::get_or_compile(const std::vector<std::string>& patterns,
+                                                                      const std::vector<unsigned int>& flags) {
+    DCHECK_EQ(patterns.size(), flags.size());
+    std::string key;
+    for (size_t i = 0; i < patterns.size(); i++) {
+        key.append(fmt::format("{}:{}:", flags[i], patterns[i].size()));
+        key.append(patterns[i]);
+    }
+
+    Cache::Handle* handle = _cache->lookup(CacheKey(key));
+    if (handle != nullptr) {
+        HyperscanDatabasePtr database = *reinterpret_cast<HyperscanDatabasePtr*>(_cache->value(handle));
+        _cache->release(handle);
+        return database;
+    }
+
+    std::vector<const char*> expressions;
+    std::vector<unsigned int> ids;
+    for (size_t i = 0; i < patterns.size(); i++) {
+        expressions.emplace_back(patterns[i].c_str());
+        ids.emplace_back(i);
+    }
+    hs_database_t* raw_database = nullptr;
+    hs_compile_error_t* compile_err = nullptr;
+    if (hs_compile_multi(expressions.data(), flags.data(), ids.data(), patterns.size(), HS_MODE_BLOCK, nullptr,
+                         &raw_database, &compile_err) != HS_SUCCESS) {
+        std::string message = compile_err != nullptr ? compile_err->message : "unknown error";
+        hs_free_compile_error(compile_err);
+        return Status::InvalidArgument(message);
+    }
+    HyperscanDatabasePtr database(raw_database, [](hs_database_t* db) { hs_free_database(db); });
+
+    size_t database_size = 0;
+    if (hs_database_size(raw_database, &database_size) != HS_SUCCESS) {
+        database_size = key.size();
+    }
+    auto* entry = new HyperscanDatabasePtr(database);
+    handle = _cache->insert(CacheKey(key), entry, database_size, [](const CacheKey& key, void* value) {
+        delete reinterpret_cast<HyperscanDatabasePtr*>(value);
+    });
+    if (handle != nullptr) {
+        _cache->release(handle);
+    }
+    return database;
+}
+
+size_t HyperscanDatabaseCache::memory_usage() const {
+    return _cache->get_memory_usage();
+}
+
+// Whether a single LIKE predicate of |pattern| takes one of the literal fast paths, which compare the bytes exactly.
+static bool is_literal_like_pattern(const std::string& pattern) {
+    return RE2::FullMatch(pattern, LIKE_ENDS_WITH_RE) || RE2::FullMatch(pattern, LIKE_STARTS_WITH_RE) ||
+           RE2::FullMatch(pattern, LIKE_EQUALS_RE) || RE2::FullMatch(pattern, LIKE_SUBSTRING_RE);
+}
+
+StatusOr<std::shared_ptr<MultiPatternMatcher>> MultiPatternMatcher::create(const std::vector<Pattern>& patterns) {
+    std::vector<std::string> expressions;
+    std::vector<unsigned int> flags;
+    for (const auto& pattern : patterns) {
+        if (pattern.is_like) {
+            // anchored as the single LIKE predicate matches, so that fusing doesn't change the result: the literal
+            // fast paths don't match a trailing newline, so they are anchored by \z, while the pattern compiled by
+            // hyperscan is anchored by $, which also matches before a trailing newline
+            if (pattern.escape_char == '\\' && is_literal_like_pattern(pattern.pattern)) {
+                auto re_pattern = LikePredicate::convert_like_pattern<false>(Slice(pattern.pattern), '\\');
+                expressions.emplace_back("^" + re_pattern + "\\z");
+            } else {
+                expressions.emplace_back(
+                        LikePredicate::convert_like_pattern<true>(Slice(pattern.pattern), pattern.escape_char));
+            }
+        } else {
+            expressions.emplace_back(pattern.pattern);
+        }
+        flags.emplace_back(HS_LIKE_FLAGS);
+    }
+
+    std::shared_ptr<MultiPatternMatcher> matcher(new MultiPatternMatcher());
+    ASSIGN_OR_RETURN(matcher->_database, HyperscanDatabaseCache::instance()->get_or_compile(expressions, flags));
+    if (auto st = hs_alloc_scratch(matcher->_database.get(), &matcher->_scratch); st != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to allocate scratch space, status: {}", st));
+    }
+    return matcher;
+}
+
+MultiPatternMatcher::~MultiPatternMatcher() {
+    if (_scratch != nullptr) {
+        hs_free_scratch(_scratch);
+    }
+}
+
+StatusOr<ColumnPtr> MultiPatternMatcher::match(const ColumnPtr& value_column) const {
+    hs_scratch_t* scratch = nullptr;
+    if (auto st = hs_clone_scratch(_scratch, &scratch); st != HS_SUCCESS) {
+        return Status::InternalError(fmt::format("unable to clone scratch space, status: {}", st));
+    }
+    DeferOp op([&] {
+        if (auto st = hs_free_scratch(scratch); st != HS_SUCCESS) {
+            LOG(ERROR) << "free scratch space failure. status: " << st;
+        }
+    });
+
+    ColumnViewer<TYPE_VARCHAR> value_viewer(value_column);
+    ColumnBuilder<TYPE_BOOLEAN> result(value_viewer.size());
+    for (int row = 0; row < value_viewer.size(); ++row) {
+        if (value_viewer.is_null(row)) {
+            result.append_null();
+            continue;
+        }
+        bool v = false;
+        auto value = value_viewer.value(row);
+        [[maybe_unused]] auto status = hs_scan(
+                _database.get(), value.size ? value.data : &LikePredicate::_DUMMY_STRING_FOR_EMPTY_PATTERN,
+                value.size, 0, scratch,
+                [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
+                   void* ctx) -> int {
+                    *((bool*)ctx) = true;
+                    // stop at the first matched pattern
+                    return 1;
+                },
+                &v);
+        DCHECK(status == HS_SUCCESS || status == HS_SCAN_TERMINATED) << " status: " << status;
+        result.append(v);
+    }
+    return result.build(value_column->is_constant());
+}
+
 bool LikePredicate::hs_compile_and_alloc_scratch(const std::string& pattern, LikePredicateState* state,
                                                  FunctionContext* context, const Slice& slice) {
-    if (hs_compile(pattern.c_str(), HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH,
-                   HS_MODE_BLOCK, nullptr, &state->database, &state->compile_err) != HS_SUCCESS) {
+    auto database_or = HyperscanDatabaseCache::instance()->get_or_compile({pattern}, {HS_LIKE_FLAGS});
+    if (!database_or.ok()) {
         std::stringstream error;
         auto chopped_size = std::min<size_t>(slice.size, 64);
         auto ellipsis = (chopped_size < slice.size) ? "..." : "";
         error << "Invalid hyperscan expression: " << std::string(slice.data, chopped_size) << ellipsis << ": "
-              << state->compile_err->message << PROMPT_INFO;
+              << database_or.status().message() << PROMPT_INFO;
         LOG(WARNING) << error.str().c_str();
-        hs_free_compile_error(state->compile_err);
         return false;
     }
+    state->database = std::move(database_or).value();
 
-    if (hs_alloc_scratch(state->database, &state->scratch) != HS_SUCCESS) {
+    if (hs_alloc_scratch(state->database.get(), &state->scratch) != HS_SUCCESS) {
         std::stringstream error;
         error << "ERROR: Unable to allocate scratch space," << PROMPT_INFO;
         LOG(WARNING) << error.str().c_str();
-        hs_free_database(state->database);
+        state->database.reset();
         return false;
     }
 
@@ -433,7 +573,7 @@ StatusOr<ColumnPtr> LikePredicate::_predicate_const_regex(FunctionContext* conte
         auto value_size = value_viewer.value(row).size;
         [[maybe_unused]] auto status = hs_scan(
                 // Use &_DUMMY_STRING_FOR_EMPTY_PATTERN instead of nullptr to avoid crash.
-                state->database, (value_size) ? value_viewer.value(row).data : &_DUMMY_STRING_FOR_EMPTY_PATTERN,
+                state->database.get(), (value_size) ? value_viewer.value(row).data : &_DUMMY_STRING_FOR_EMPTY_PATTERN,
                 value_size, 0, scratch,
                 [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
                    void* ctx) -> int {
@@ -627,10 +767,15 @@ StatusOr<ColumnPtr> LikePredicate::regex_match_partial(FunctionContext* context,
 
 template <bool fullMatch>
 std::string LikePredicate::convert_like_pattern(FunctionContext* context, const Slice& pattern) {
+    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    return convert_like_pattern<fullMatch>(pattern, state->escape_char);
+}
+
+template <bool fullMatch>
+std::string LikePredicate::convert_like_pattern(const Slice& pattern, char escape_char) {
     std::string re_pattern;
     re_pattern.clear();
 
-    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
     bool is_escaped = false;
 
     if constexpr (fullMatch) {
@@ -643,7 +788,7 @@ std::string LikePredicate::convert_like_pattern(FunctionContext* context, const
         } else if (!is_escaped && pattern.data[i] == '_') {
             re_pattern.append(".");
             // check for escape char before checking for regex special chars, they might overlap
-        } else if (!is_escaped && pattern.data[i] == state->escape_char) {
+        } else if (!is_escaped && pattern.data[i] == escape_char) {
             is_escaped = true;
         } else if (pattern.data[i] == '.' || pattern.data[i] == '[' || pattern.data[i] == ']' ||
                    pattern.data[i] == '{' || pattern.data[i] == '}' || pattern.data[i] == '(' ||
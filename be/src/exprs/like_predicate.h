@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -28,6 +29,60 @@
 
 namespace starrocks {
 
+class Cache;
+
+using HyperscanDatabasePtr = std::shared_ptr<hs_database_t>;
+
+// A process-wide LRU cache of compiled hyperscan databases keyed by their patterns and flags, so that every
+// fragment instance evaluating the same LIKE / REGEXP predicates shares one database instead of compiling its own.
+class HyperscanDatabaseCache {
+public:
+    static HyperscanDatabaseCache* instance();
+
+    ~HyperscanDatabaseCache();
+
+    // Returns the block mode database of |patterns|, the i-th pattern is compiled with |flags[i]| and reports
+    // id i on match. Returns an error with the message of hyperscan if any pattern can't be compiled.
+    StatusOr<HyperscanDatabasePtr> get_or_compile(const std::vector<std::string>& patterns,
+                                                  const std::vector<unsigned int>& flags);
+
+    size_t memory_usage() const;
+
+private:
+    HyperscanDatabaseCache();
+
+    std::unique_ptr<Cache> _cache;
+};
+
+// Matches values against a set of LIKE and REGEXP patterns with one multi-pattern hyperscan database, so that a
+// disjunction of such predicates on one column scans each value once instead of once per predicate.
+class MultiPatternMatcher {
+public:
+    struct Pattern {
+        std::string pattern;
+        // LIKE pattern if true, otherwise a regular expression of REGEXP
+        bool is_like;
+        // the escape character of a LIKE pattern
+        char escape_char = '\\';
+    };
+
+    // Returns an error if the patterns can't be compiled by hyperscan, the caller should evaluate the
+    // predicates one by one instead.
+    static StatusOr<std::shared_ptr<MultiPatternMatcher>> create(const std::vector<Pattern>& patterns);
+
+    ~MultiPatternMatcher();
+
+    // Returns whether each value of |value_column| matches any pattern, null if the value is null.
+    StatusOr<ColumnPtr> match(const ColumnPtr& value_column) const;
+
+private:
+    MultiPatternMatcher() = default;
+
+    HyperscanDatabasePtr _database;
+    // the prototype of scratch space, cloned by each call of match
+    hs_scratch_t* _scratch = nullptr;
+};
+
 class LikePredicate {
 public:
     // Like method
@@ -151,9 +206,14 @@ private:
     template <bool fullMatch>
     static std::string convert_like_pattern(FunctionContext* context, const Slice& pattern);
 
+    template <bool fullMatch>
+    static std::string convert_like_pattern(const Slice& pattern, char escape_char);
+
     static void remove_escape_character(std::string* search_string);
 
 private:
+    friend class MultiPatternMatcher;
+
     static StatusOr<ColumnPtr> _predicate_const_regex(FunctionContext* context, ColumnBuilder<TYPE_BOOLEAN>* result,
                                                       const ColumnViewer<TYPE_VARCHAR>& value_viewer,
                                                       const ColumnPtr& value_column);
@@ -192,10 +252,8 @@ private:
 
         ColumnPtr _search_string_column;
 
-        // a pointer to the generated database that responsible for parsed expression.
-        hs_database_t* database = nullptr;
-        // a type containing error details that is returned by the compile calls on failure.
-        hs_compile_error_t* compile_err = nullptr;
+        // the generated database that responsible for parsed expression, shared by HyperscanDatabaseCache.
+        HyperscanDatabasePtr database;
         // A Hyperscan scratch space, Used to call hs_scan,
         // one scratch space per thread, or concurrent caller, is required
         hs_scratch_t* scratch = nullptr;
@@ -206,10 +264,6 @@ private:
             if (scratch != nullptr) {
                 hs_free_scratch(scratch);
             }
-
-            if (database != nullptr) {
-                hs_free_database(database);
-            }
         }
 
         void set_search_string(const std::string& search_string_arg) {
@@ -41,7 +41,7 @@ struct LocateCaseSensitiveUTF8 {
 // locate haystack is a vector and needle is a constant
 ColumnPtr haystack_vector_and_needle_const(const ColumnPtr& haystack_ptr, const ColumnPtr& needle_ptr,
                                            const ColumnPtr& start_pos_ptr) {
-    BinaryColumn* haystack = nullptr;
+    const BinaryColumn* haystack = nullptr;
     FixedLengthColumn<int32_t>* start_pos = nullptr;
     NullColumnPtr res_null = nullptr;
     ColumnPtr start_pos_expansion = nullptr;
@@ -116,6 +116,8 @@ ColumnPtr haystack_vector_and_needle_const(const ColumnPtr& haystack_ptr, const
     size_t i = 0;
 
     auto searcher = LocateCaseSensitiveUTF8::createSearcherInBigHaystack(needle.data, needle.size, end - pos);
+    // in an ascii haystack, a char position is a byte offset
+    const bool is_ascii = haystack->is_ascii();
 
     /// We will search for the next occurrence in all strings at once.
     while (pos < end && end != (pos = searcher.search(pos, end - pos))) {
@@ -130,9 +132,11 @@ ColumnPtr haystack_vector_and_needle_const(const ColumnPtr& haystack_ptr, const
         if (start <= 0 || pos + needle.size > begin + offsets[i + 1]) {
             res->get_data()[i] = 0;
         } else {
-            size_t res_pos = 1 + utf8_len(begin + offsets[i], pos);
+            const char* row_end = begin + offsets[i + 1];
+            size_t res_pos = 1 + (is_ascii ? pos - (begin + offsets[i]) : utf8_len(begin + offsets[i], pos));
             if (res_pos < start) {
-                pos = skip_leading_utf8(pos, begin + offsets[i + 1], start - res_pos);
+                pos = is_ascii ? std::min(pos + (start - res_pos), row_end)
+                               : skip_leading_utf8(pos, row_end, start - res_pos);
                 continue;
             }
             res->get_data()[i] = res_pos;
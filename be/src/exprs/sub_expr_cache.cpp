@@ -0,0 +1,182 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/sub_expr_cache.h"
+
+#include <fmt/format.h>
+
+#include "column/chunk.h"
+#include "column/const_column.h"
+#include "common/config.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr.h"
+#include "exprs/expr_context.h"
+#include "exprs/function_call_expr.h"
+#include "exprs/literal.h"
+#include "gutil/casts.h"
+
+namespace starrocks {
+
+static thread_local SubExprCache* tls_sub_expr_cache = nullptr;
+
+// Appends the fingerprint of the tree of |expr| to |out|, returns false if some expr in it is not identified by
+// its type, node type, function id, slot id or literal value.
+static bool append_fingerprint(const Expr* expr, std::string* out) {
+    if (expr->is_literal()) {
+        const auto* literal = dynamic_cast<const VectorizedLiteral*>(expr);
+        if (literal == nullptr || !literal->value()->is_constant()) {
+            return false;
+        }
+        // some columns, e.g. json and object columns, don't print their values
+        const auto* value = down_cast<const ConstColumn*>(literal->value().get());
+        std::string item = value->data_column()->debug_item(0);
+        if (item.empty()) {
+            return false;
+        }
+        out->append(fmt::format("L{}:{}:{}", expr->type().debug_string(), item.size(), item));
+        return true;
+    }
+
+    switch (expr->node_type()) {
+    case TExprNodeType::SLOT_REF: {
+        const auto* ref = dynamic_cast<const ColumnRef*>(expr);
+        if (ref == nullptr) {
+            return false;
+        }
+        out->append(fmt::format("S{}:{}", ref->slot_id(), expr->type().debug_string()));
+        return true;
+    }
+    case TExprNodeType::FUNCTION_CALL: {
+        // java udfs and the other function call exprs have their own state
+        const auto* call = dynamic_cast<const VectorizedFunctionCallExpr*>(expr);
+        if (call == nullptr || call->is_returning_random_value() || !expr->fn().__isset.fid ||
+            expr->fn().__isset.agg_state_desc) {
+            return false;
+        }
+        out->append(fmt::format("F{}:{}(", expr->fn().fid, expr->type().debug_string()));
+        break;
+    }
+    case TExprNodeType::CAST_EXPR:
+        out->append(fmt::format("C{}:{}(", static_cast<int>(expr->op()), expr->type().debug_string()));
+        break;
+    default:
+        return false;
+    }
+    for (size_t i = 0; i < expr->children().size(); i++) {
+        if (i > 0) {
+            out->push_back(',');
+        }
+        if (!append_fingerprint(expr->children()[i], out)) {
+            return false;
+        }
+    }
+    out->push_back(')');
+    return true;
+}
+
+std::string SubExprCache::fingerprint(const Expr* expr) {
+    if (expr->node_type() != TExprNodeType::FUNCTION_CALL || expr->is_constant()) {
+        return {};
+    }
+    std::string key;
+    if (!append_fingerprint(expr, &key)) {
+        return {};
+    }
+    return key;
+}
+
+SubExprCache* SubExprCache::current() {
+    return tls_sub_expr_cache;
+}
+
+void SubExprCache::add(const std::vector<ExprContext*>& ctxs) {
+    for (auto* ctx : ctxs) {
+        _add(ctx->root());
+    }
+}
+
+void SubExprCache::_add(const Expr* expr) {
+    const std::string& key = expr->memo_key();
+    if (!key.empty() && ++_key_counts[key] == 2) {
+        _shared_keys.insert(key);
+    }
+    for (const auto* child : expr->children()) {
+        _add(child);
+    }
+}
+
+StatusOr<ColumnPtr> SubExprCache::evaluate(const Expr* expr, Chunk* chunk,
+                                           const std::function<StatusOr<ColumnPtr>()>& compute) {
+    const std::string& key = expr->memo_key();
+    if (chunk == nullptr || key.empty() || !_shared_keys.contains(key)) {
+        return compute();
+    }
+    auto iter = _entries.find(key);
+    if (iter != _entries.end() && _is_valid(iter->second, chunk)) {
+        return iter->second.result;
+    }
+
+    ASSIGN_OR_RETURN(ColumnPtr column, compute());
+    if (column->is_constant()) {
+        return column;
+    }
+    Entry entry;
+    expr->get_slot_ids(&entry.slot_ids);
+    if (entry.slot_ids.empty()) {
+        return column;
+    }
+    for (SlotId slot_id : entry.slot_ids) {
+        if (!chunk->is_slot_exist(slot_id)) {
+            return column;
+        }
+        const auto& input = chunk->get_column_by_slot_id(slot_id);
+        entry.input_sizes.emplace_back(input->size());
+        entry.inputs.emplace_back(input);
+    }
+    entry.result = column;
+    _entries.insert_or_assign(key, std::move(entry));
+    return column;
+}
+
+bool SubExprCache::_is_valid(const Entry& entry, const Chunk* chunk) {
+    if (entry.result->size() != chunk->num_rows()) {
+        return false;
+    }
+    for (size_t i = 0; i < entry.slot_ids.size(); i++) {
+        if (!chunk->is_slot_exist(entry.slot_ids[i])) {
+            return false;
+        }
+        const auto& input = chunk->get_column_by_slot_id(entry.slot_ids[i]);
+        if (input.get() != entry.inputs[i].get() || input->size() != entry.input_sizes[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+SubExprCacheScope::SubExprCacheScope(SubExprCache* cache) : _prev(tls_sub_expr_cache) {
+    if (cache != nullptr && !cache->empty() && config::enable_sub_expr_cache) {
+        _cache = cache;
+        tls_sub_expr_cache = cache;
+    }
+}
+
+SubExprCacheScope::~SubExprCacheScope() {
+    if (_cache != nullptr) {
+        _cache->clear();
+        tls_sub_expr_cache = _prev;
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,99 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "column/vectorized_fwd.h"
+#include "common/global_types.h"
+#include "common/statusor.h"
+
+namespace starrocks {
+
+class Expr;
+class ExprContext;
+
+// Shares the result columns of deterministic function calls between the ExprContexts of one operator, so that a
+// subexpression repeated in several expressions, e.g. get_json_string(payload, '$.user') used both in the
+// conjuncts and in the projection, is evaluated once per chunk.
+//
+// The operator registers all its ExprContexts once, only the function calls which occur more than once in the
+// registered trees are memoized. Around the evaluation of a chunk, it installs the cache on the current thread by a
+// SubExprCacheScope, and every function call with a memo key looks itself up in it when evaluated, wherever it is in
+// the tree, e.g. under a predicate or a cast. The entries are dropped when the scope ends.
+// not thread-safe
+class SubExprCache {
+public:
+    // Returns the memo key of the function call |expr|, identifying the function, the result type and the whole
+    // argument tree. Returns an empty string if the result can't be shared, e.g. the tree contains an expr which
+    // is not deterministic, is constant, or has some state that isn't described by the key.
+    static std::string fingerprint(const Expr* expr);
+
+    // The cache installed on the current thread, nullptr if none.
+    static SubExprCache* current();
+
+    void add(const std::vector<ExprContext*>& ctxs);
+
+    bool empty() const { return _shared_keys.empty(); }
+
+    // Returns the memoized column of |expr| on |chunk|, computes it by |compute| and memoizes it on a miss.
+    // A constant result is not memoized, some functions unfold the constant arguments in place.
+    StatusOr<ColumnPtr> evaluate(const Expr* expr, Chunk* chunk, const std::function<StatusOr<ColumnPtr>()>& compute);
+
+    void clear() { _entries.clear(); }
+
+private:
+    friend class SubExprCacheScope;
+
+    struct Entry {
+        // the columns of the slots referenced by the expr and their sizes when the entry is inserted, holding them
+        // keeps the addresses from being reused
+        std::vector<SlotId> slot_ids;
+        Columns inputs;
+        std::vector<size_t> input_sizes;
+        ColumnPtr result;
+    };
+
+    void _add(const Expr* expr);
+
+    // An entry is valid as long as the chunk holds the same columns with the same sizes for the referenced slots,
+    // the chunk may have been filtered or have some columns replaced since the entry was inserted.
+    static bool _is_valid(const Entry& entry, const Chunk* chunk);
+
+    std::unordered_map<std::string, int> _key_counts;
+    std::unordered_set<std::string> _shared_keys;
+    std::unordered_map<std::string, Entry> _entries;
+};
+
+// Installs |cache| on the current thread until the scope ends. Does nothing if |cache| is nullptr or has nothing
+// to share, or config::enable_sub_expr_cache is false.
+class SubExprCacheScope {
+public:
+    explicit SubExprCacheScope(SubExprCache* cache);
+    ~SubExprCacheScope();
+
+    SubExprCacheScope(const SubExprCacheScope&) = delete;
+    SubExprCacheScope& operator=(const SubExprCacheScope&) = delete;
+
+private:
+    SubExprCache* _cache = nullptr;
+    SubExprCache* _prev = nullptr;
+};
+
+} // namespace starrocks
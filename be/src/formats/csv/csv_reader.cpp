@@ -16,6 +16,8 @@
 
 #include <unordered_set>
 
+#include "formats/csv/csv_simd.h"
+
 namespace starrocks {
 
 using Field = Slice;
@@ -184,6 +186,9 @@ Status CSVReader::more_rows() {
     bool is_escape_column = false;
     bool notGetLine = true;
     bool reachBuffEnd = false;
+    // Only these bytes can change the state in ORDINARY state, the others are skipped in batch.
+    const char row_delimiter_start = _parse_options.row_delimiter[0];
+    const char column_delimiter_start = _parse_options.column_delimiter[0];
     _columns.clear();
     while (true) {
         // At the end of a row, or the end of a column, no new data is read.
@@ -270,8 +275,10 @@ Status CSVReader::more_rows() {
                 _buff.skip(1);
                 break;
             }
-            // other character
+            // other character, skip it and the following bytes until the next enclose or escape character.
             _buff.skip(1);
+            _buff.skip(csv::count_until_any_of(_buff.position(), _buff.available(), _parse_options.enclose,
+                                               _parse_options.enclose, _parse_options.escape, _parse_options.escape));
             break;
 
         case ENCLOSE_ESCAPE:
@@ -342,6 +349,8 @@ Status CSVReader::more_rows() {
             }
 
             _buff.skip(1);
+            _buff.skip(csv::count_until_any_of(_buff.position(), _buff.available(), row_delimiter_start,
+                                               column_delimiter_start, _parse_options.escape, _parse_options.enclose));
             curState = ORDINARY;
             break;
 
@@ -555,17 +564,19 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        const char* const end = record.data + size;
+        // memchr scans a vector at a time, much faster than comparing byte by byte for long columns.
+        while ((ptr = static_cast<const char*>(memchr(value, _parse_options.column_delimiter[0], end - value))) !=
+               nullptr) {
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, ptr - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, ptr - value);
             }
+            value = ptr + 1;
         }
+        ptr = end;
     } else {
         const auto* const base = ptr;
 
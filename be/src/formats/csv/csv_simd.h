@@ -0,0 +1,90 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace starrocks::csv {
+
+// Returns the number of leading bytes of [data, data + size) which are equal to none of |c0|, |c1|, |c2| and |c3|,
+// returns |size| if there is no such byte.
+// The CSV parser uses it to skip the bytes which can not change the parse state (i.e. not the first byte of a
+// delimiter, an escape or an enclose character) a block at a time instead of one state transition per byte.
+inline size_t count_until_any_of(const char* data, size_t size, char c0, char c1, char c2, char c3) {
+    size_t i = 0;
+#ifdef __AVX2__
+    const __m256i v0 = _mm256_set1_epi8(c0);
+    const __m256i v1 = _mm256_set1_epi8(c1);
+    const __m256i v2 = _mm256_set1_epi8(c2);
+    const __m256i v3 = _mm256_set1_epi8(c3);
+    for (; i + 32 <= size; i += 32) {
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        const __m256i eq = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, v0), _mm256_cmpeq_epi8(block, v1)),
+                                           _mm256_or_si256(_mm256_cmpeq_epi8(block, v2), _mm256_cmpeq_epi8(block, v3)));
+        const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+#ifdef __SSE2__
+    const __m128i u0 = _mm_set1_epi8(c0);
+    const __m128i u1 = _mm_set1_epi8(c1);
+    const __m128i u2 = _mm_set1_epi8(c2);
+    const __m128i u3 = _mm_set1_epi8(c3);
+    for (; i + 16 <= size; i += 16) {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        const __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, u0), _mm_cmpeq_epi8(block, u1)),
+                                        _mm_or_si128(_mm_cmpeq_epi8(block, u2), _mm_cmpeq_epi8(block, u3)));
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(eq));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16_t u0 = vdupq_n_u8(c0);
+    const uint8x16_t u1 = vdupq_n_u8(c1);
+    const uint8x16_t u2 = vdupq_n_u8(c2);
+    const uint8x16_t u3 = vdupq_n_u8(c3);
+    for (; i + 16 <= size; i += 16) {
+        const uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        const uint8x16_t eq = vorrq_u8(vorrq_u8(vceqq_u8(block, u0), vceqq_u8(block, u1)),
+                                       vorrq_u8(vceqq_u8(block, u2), vceqq_u8(block, u3)));
+        if (vmaxvq_u8(eq) != 0) {
+            // locate the byte in the scalar loop below
+            break;
+        }
+    }
+#endif
+    for (; i < size; i++) {
+        const char c = data[i];
+        if (c == c0 || c == c1 || c == c2 || c == c3) {
+            return i;
+        }
+    }
+    return size;
+}
+
+} // namespace starrocks::csv
@@ -20,6 +20,43 @@
 
 namespace starrocks {
 
+// Copies |size| values of a orc vector batch into a column, with one memcpy if they share the same layout.
+template <typename T, typename CvbT>
+static inline void copy_cvb_values(T* dst, const CvbT* src, size_t size) {
+    if constexpr (std::is_same_v<T, CvbT>) {
+        strings::memcpy_inlined(dst, src, size * sizeof(T));
+    } else {
+        for (size_t i = 0; i < size; i++) {
+            dst[i] = src[i];
+        }
+    }
+}
+
+// The direct string reader of orc reads all values of a batch into one blob back to back, which is broken
+// once the batch is filtered. Returns true if the values in [from, from + size) are still laid out like that,
+// and null values are empty, so that they can be copied to a BinaryColumn with one memcpy.
+static inline bool is_contiguous_string_batch(const orc::StringVectorBatch* data, size_t from, size_t size) {
+    if (size == 0 || data->use_codes) {
+        return false;
+    }
+    const char* const* starts = data->data.data() + from;
+    const int64_t* lengths = data->length.data() + from;
+    const char* not_null = data->hasNulls ? data->notNull.data() + from : nullptr;
+    for (size_t i = 0; i + 1 < size; i++) {
+        if (starts[i] + lengths[i] != starts[i + 1]) {
+            return false;
+        }
+    }
+    if (not_null != nullptr) {
+        for (size_t i = 0; i < size; i++) {
+            if (!not_null[i] && lengths[i] != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 StatusOr<std::unique_ptr<ORCColumnReader>> ORCColumnReader::create(const TypeDescriptor& type,
                                                                    const orc::Type* orc_type, bool nullable,
                                                                    const OrcMappingPtr& orc_mapping,
@@ -217,9 +254,7 @@ Status IntColumnReader<Type>::_fill_int_column_with_null_from_cvb(OrcColumnVecto
     auto* values = ColumnHelper::cast_to_raw<Type>(null_column->data_column())->get_data().data();
     auto* cvbd = data->data.data();
 
-    for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
-        values[i] = cvbd[cvb_pos];
-    }
+    copy_cvb_values(values + col_start, cvbd + from, size);
 
     // col_start == 0 and from == 0 means it's at top level of fill chunk, not in the middle of array
     // otherwise `broker_load_filter` does not work.
@@ -272,9 +307,7 @@ Status IntColumnReader<Type>::_fill_int_column_from_cvb(OrcColumnVectorBatch* da
 
     auto* cvbd = data->data.data();
 
-    for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
-        values[i] = cvbd[cvb_pos];
-    }
+    copy_cvb_values(values + col_start, cvbd + from, size);
 
     // col_start == 0 and from == 0 means it's at top level of fill chunk, not in the middle of array
     // otherwise `broker_load_filter` does not work.
@@ -339,10 +372,7 @@ Status DoubleColumnReader<Type>::_fill_double_column_from_cvb(OrcColumnVectorBat
     auto* values = ColumnHelper::cast_to_raw<Type>(data_column)->get_data().data();
     auto* cvb_data = data->data.data();
 
-    for (size_t column_pos = column_start, vb_pos = vb_pos_from; column_pos < column_start + size;
-         column_pos++, vb_pos++) {
-        values[column_pos] = cvb_data[vb_pos];
-    }
+    copy_cvb_values(values + column_start, cvb_data + vb_pos_from, size);
     return Status::OK();
 }
 
@@ -518,7 +548,15 @@ Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col,
     raw::stl_vector_resize_uninitialized(&vo, vo.size() + size);
 
     size_t write_pos = vb.size();
-    if (cvb->hasNulls) {
+    if (_type.type != TYPE_CHAR && is_contiguous_string_batch(data, from, size)) {
+        // copy all values at once and derive the offsets from the lengths
+        strings::memcpy_inlined(&vb[write_pos], data->data[from], len);
+        for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
+            write_pos += data->length[cvb_pos];
+            // Need plus 1 for offset
+            vo[i + 1] = write_pos;
+        }
+    } else if (cvb->hasNulls) {
         if (_type.type == TYPE_CHAR) {
             // Possibly there are some zero padding characters in value, we have to strip them off.
             for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
@@ -14,43 +14,85 @@
 
 #include "formats/parquet/chunk_writer.h"
 
+#include <fmt/format.h>
 #include <parquet/file_writer.h>
 #include <parquet/schema.h>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <numeric>
 #include <utility>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exprs/function_context.h"
 #include "formats/parquet/column_chunk_writer.h"
 #include "formats/parquet/level_builder.h"
+#include "runtime/current_thread.h"
 
 namespace starrocks::parquet {
 
+static int num_leaf_columns(const ::parquet::schema::Node* node) {
+    if (node->is_primitive()) {
+        return 1;
+    }
+    auto group = static_cast<const ::parquet::schema::GroupNode*>(node);
+    int num_leaves = 0;
+    for (int i = 0; i < group->field_count(); i++) {
+        num_leaves += num_leaf_columns(group->field(i).get());
+    }
+    return num_leaves;
+}
+
 ChunkWriter::ChunkWriter(::parquet::RowGroupWriter* rg_writer, std::vector<TypeDescriptor> type_descs,
                          std::shared_ptr<::parquet::schema::GroupNode> schema,
                          std::function<StatusOr<ColumnPtr>(Chunk*, size_t)> eval_func, std::string timezone,
-                         bool use_legacy_decimal_encoding, bool use_int96_timestamp_encoding)
+                         bool use_legacy_decimal_encoding, bool use_int96_timestamp_encoding,
+                         PriorityThreadPool* executors)
         : _rg_writer(rg_writer),
           _type_descs(std::move(type_descs)),
           _schema(std::move(schema)),
           _eval_func(std::move(eval_func)),
           _timezone(std::move(timezone)),
           _use_legacy_decimal_encoding(use_legacy_decimal_encoding),
-          _use_int96_timestamp_encoding(use_int96_timestamp_encoding) {
+          _use_int96_timestamp_encoding(use_int96_timestamp_encoding),
+          _executors(executors) {
     int num_columns = rg_writer->num_columns();
     _estimated_buffered_bytes.resize(num_columns);
     std::fill(_estimated_buffered_bytes.begin(), _estimated_buffered_bytes.end(), 0);
+    int offset = 0;
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        _leaf_column_offsets.push_back(offset);
+        offset += num_leaf_columns(_schema->field(i).get());
+    }
 }
 
 Status ChunkWriter::write(Chunk* chunk) {
     LevelBuilderContext ctx(chunk->num_rows());
 
-    // Writes out all leaf parquet columns to the RowGroupWriter. Each leaf column is written fully before
-    // the next column is written. Columns are written in DFS order.
-    int leaf_column_idx = 0;
+    // Evaluates the columns in the calling thread, the expressions may not be thread safe.
+    Columns cols(_type_descs.size());
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        ASSIGN_OR_RETURN(cols[i], _eval_func(chunk, i));
+    }
+
+    int parallelism = std::min<int>(config::parquet_writer_column_encode_parallelism, _type_descs.size());
+    if (_executors != nullptr && parallelism > 1) {
+        return _write_columns_in_parallel(ctx, cols, parallelism);
+    }
+    for (size_t i = 0; i < _type_descs.size(); i++) {
+        RETURN_IF_ERROR(_write_column(ctx, i, cols[i]));
+    }
+    return Status::OK();
+}
+
+Status ChunkWriter::_write_column(const LevelBuilderContext& ctx, size_t i, const ColumnPtr& col) {
+    // Writes out all leaf parquet columns of the column to the RowGroupWriter. Each leaf column is written fully
+    // before the next column is written. Columns are written in DFS order.
+    int leaf_column_idx = _leaf_column_offsets[i];
 
     auto write_leaf_column = [&](const LevelBuilderResult& result) {
         auto leaf_column_writer = ColumnChunkWriter(_rg_writer->column(leaf_column_idx));
@@ -59,15 +101,64 @@ Status ChunkWriter::write(Chunk* chunk) {
         ++leaf_column_idx;
     };
 
-    for (size_t i = 0; i < _type_descs.size(); i++) {
-        ASSIGN_OR_RETURN(auto col, _eval_func(chunk, i));
-        auto level_builder = LevelBuilder(_type_descs[i], _schema->field(i), _timezone, _use_legacy_decimal_encoding,
-                                          _use_int96_timestamp_encoding);
-        RETURN_IF_ERROR(level_builder.init());
-        RETURN_IF_ERROR(level_builder.write(ctx, col, write_leaf_column));
+    auto level_builder = LevelBuilder(_type_descs[i], _schema->field(i), _timezone, _use_legacy_decimal_encoding,
+                                      _use_int96_timestamp_encoding);
+    RETURN_IF_ERROR(level_builder.init());
+    return level_builder.write(ctx, col, write_leaf_column);
+}
+
+// The leaf column writers of a buffered row group are independent of each other, each one encodes and compresses
+// pages into its own in-memory buffer, so the columns could be written by different threads.
+Status ChunkWriter::_write_columns_in_parallel(const LevelBuilderContext& ctx, const Columns& cols,
+                                               int parallelism) {
+    // The state is shared with the tasks, a task may be scheduled after all columns are written by other threads.
+    struct WriteState {
+        std::atomic<size_t> next_column{0};
+        size_t num_columns = 0;
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t finished_columns = 0;
+        Status status;
+    };
+    auto state = std::make_shared<WriteState>();
+    state->num_columns = cols.size();
+
+    auto run = [this, &ctx, &cols](WriteState* state) {
+        size_t i;
+        while ((i = state->next_column.fetch_add(1)) < state->num_columns) {
+            Status st;
+            try {
+                st = _write_column(ctx, i, cols[i]);
+            } catch (const std::exception& e) {
+                st = Status::IOError(fmt::format("write parquet column error: {}", e.what()));
+            }
+            std::lock_guard l(state->mutex);
+            state->status.update(st);
+            if (++state->finished_columns == state->num_columns) {
+                state->cv.notify_all();
+            }
+        }
+    };
+
+    auto* mem_tracker = CurrentThread::mem_tracker();
+    for (int i = 0; i < parallelism - 1; i++) {
+        bool ok = _executors->try_offer([state, run, mem_tracker]() {
+            if (state->next_column.load() >= state->num_columns) {
+                return;
+            }
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            run(state.get());
+        });
+        if (!ok) {
+            // the pool is busy, the remaining columns are written by the calling thread.
+            break;
+        }
     }
+    run(state.get());
 
-    return Status::OK();
+    std::unique_lock l(state->mutex);
+    state->cv.wait(l, [&] { return state->finished_columns == state->num_columns; });
+    return state->status;
 }
 
 void ChunkWriter::close() {
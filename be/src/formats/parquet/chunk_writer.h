@@ -58,6 +58,8 @@ class StatusOr;
 
 namespace starrocks::parquet {
 
+class LevelBuilderContext;
+
 // Wraps parquet::RowGroupWriter.
 // Write chunks into buffer. Flush on closing.
 class ChunkWriter {
@@ -65,7 +67,8 @@ public:
     ChunkWriter(::parquet::RowGroupWriter* rg_writer, std::vector<TypeDescriptor> type_descs,
                 std::shared_ptr<::parquet::schema::GroupNode> schema,
                 std::function<StatusOr<ColumnPtr>(Chunk*, size_t)> eval_func, std::string timezone,
-                bool use_legacy_decimal_encoding = false, bool use_int96_timestamp_encoding = false);
+                bool use_legacy_decimal_encoding = false, bool use_int96_timestamp_encoding = false,
+                PriorityThreadPool* executors = nullptr);
 
     Status write(Chunk* chunk);
 
@@ -74,6 +77,13 @@ public:
     int64_t estimated_buffered_bytes() const;
 
 private:
+    // Builds the levels of the |i|-th column and writes its leaf columns.
+    Status _write_column(const LevelBuilderContext& ctx, size_t i, const ColumnPtr& col);
+
+    // Writes the columns with up to `parquet_writer_column_encode_parallelism` tasks, the calling thread is one of
+    // them and picks up the columns which are not picked up by the tasks in |_executors|.
+    Status _write_columns_in_parallel(const LevelBuilderContext& ctx, const Columns& cols, int parallelism);
+
     ::parquet::RowGroupWriter* _rg_writer;
     std::vector<TypeDescriptor> _type_descs;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
@@ -82,6 +92,9 @@ private:
     std::string _timezone;
     bool _use_legacy_decimal_encoding = false;
     bool _use_int96_timestamp_encoding = false;
+    PriorityThreadPool* _executors = nullptr;
+    // index of the first leaf column of each column in the row group
+    std::vector<int> _leaf_column_offsets;
 };
 
 } // namespace starrocks::parquet
@@ -24,6 +24,7 @@
 #include "column/column.h"
 #include "column/vectorized_fwd.h"
 #include "common/status.h"
+#include "common/statusor.h"
 #include "exec/hdfs_scanner.h"
 #include "formats/parquet/column_reader.h"
 #include "formats/parquet/encoding.h"
@@ -123,6 +124,14 @@ public:
         return _cur_decoder->get_dict_values(dict_codes, nulls, column);
     }
 
+    StatusOr<size_t> get_dict_avg_value_size() {
+        RETURN_IF_ERROR(_try_load_dictionary());
+        if (!_dict_page_parsed) {
+            return 0;
+        }
+        return _cur_decoder->get_dict_avg_value_size();
+    }
+
     Status seek_to_offset(const uint64_t off) {
         RETURN_IF_ERROR(_page_reader->seek_to_offset(off));
         _page_parse_state = INITIALIZED;
@@ -190,6 +190,16 @@ public:
         return false;
     }
 
+    // Select the pages which may contain null rows of the top level column according to the null counts in
+    // the column index, used to evaluate `col IS NULL` of nested columns.
+    // return true means page index filter happened
+    // return false means no page index filter happened
+    virtual StatusOr<bool> page_index_null_filter(SparseRange<uint64_t>* row_ranges, const uint64_t rg_first_row,
+                                                  const uint64_t rg_num_rows) {
+        DCHECK(row_ranges->empty());
+        return false;
+    }
+
     virtual StatusOr<bool> row_group_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
                                                   CompoundNodeType pred_relation, const uint64_t rg_first_row,
                                                   const uint64_t rg_num_rows) const {
@@ -327,6 +327,77 @@ Status StructColumnReader::fill_dst_column(ColumnPtr& dst, ColumnPtr& src) {
     return Status::OK();
 }
 
+// Return true if |predicate| is `col IS NULL` of the column itself, e.g. `array_col IS NULL`.
+static bool is_column_is_null_predicate(const ColumnPredicate* predicate) {
+    if (!predicate->is_expr_predicate()) {
+        return false;
+    }
+    const auto& expr_ctxs = down_cast<const ColumnExprPredicate*>(predicate)->get_expr_ctxs();
+    if (expr_ctxs.size() != 1) {
+        return false;
+    }
+    const Expr* root = expr_ctxs[0]->root();
+    std::string null_str;
+    if (!root->is_null_scalar_function(null_str) || null_str != "null") {
+        return false;
+    }
+    return root->children().size() == 1 && root->get_child(0)->is_slotref();
+}
+
+// Only `col IS NULL` can be evaluated by the page index of nested columns, other predicates select all rows.
+static StatusOr<bool> nested_page_index_zone_map_filter(ColumnReader* reader,
+                                                        const std::vector<const ColumnPredicate*>& predicates,
+                                                        SparseRange<uint64_t>* row_ranges,
+                                                        CompoundNodeType pred_relation, const uint64_t rg_first_row,
+                                                        const uint64_t rg_num_rows) {
+    DCHECK(row_ranges->empty());
+    std::optional<SparseRange<uint64_t>> null_row_ranges;
+    std::optional<SparseRange<uint64_t>> result_sparse_range = std::nullopt;
+    for (const ColumnPredicate* predicate : predicates) {
+        SparseRange<uint64_t> tmp_row_ranges;
+        if (is_column_is_null_predicate(predicate)) {
+            if (!null_row_ranges.has_value()) {
+                null_row_ranges.emplace();
+                auto ret = reader->page_index_null_filter(&null_row_ranges.value(), rg_first_row, rg_num_rows);
+                if (!ret.value_or(false)) {
+                    // no page index filter happened, means select all
+                    null_row_ranges->clear();
+                    null_row_ranges->add({rg_first_row, rg_first_row + rg_num_rows});
+                }
+            }
+            tmp_row_ranges = null_row_ranges.value();
+        } else {
+            tmp_row_ranges.add({rg_first_row, rg_first_row + rg_num_rows});
+        }
+
+        if (pred_relation == CompoundNodeType::AND) {
+            PredicateFilterEvaluatorUtils::merge_row_ranges<CompoundNodeType::AND>(result_sparse_range, tmp_row_ranges);
+        } else {
+            PredicateFilterEvaluatorUtils::merge_row_ranges<CompoundNodeType::OR>(result_sparse_range, tmp_row_ranges);
+        }
+    }
+
+    if (!result_sparse_range.has_value()) {
+        return false;
+    }
+    *row_ranges = std::move(result_sparse_range.value());
+    return row_ranges->span_size() < rg_num_rows;
+}
+
+StatusOr<bool> ListColumnReader::page_index_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                                            SparseRange<uint64_t>* row_ranges,
+                                                            CompoundNodeType pred_relation,
+                                                            const uint64_t rg_first_row, const uint64_t rg_num_rows) {
+    return nested_page_index_zone_map_filter(this, predicates, row_ranges, pred_relation, rg_first_row, rg_num_rows);
+}
+
+StatusOr<bool> MapColumnReader::page_index_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                                           SparseRange<uint64_t>* row_ranges,
+                                                           CompoundNodeType pred_relation,
+                                                           const uint64_t rg_first_row, const uint64_t rg_num_rows) {
+    return nested_page_index_zone_map_filter(this, predicates, row_ranges, pred_relation, rg_first_row, rg_num_rows);
+}
+
 StatusOr<bool> StructColumnReader::row_group_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
                                                              CompoundNodeType pred_relation,
                                                              const uint64_t rg_first_row,
@@ -376,6 +447,9 @@ StatusOr<bool> StructColumnReader::page_index_zone_map_filter(const std::vector<
 
     auto handle_page_index = [&](const ColumnPredicate* predicate, SparseRange<uint64_t>* cur_row_ranges) -> bool {
         DCHECK(cur_row_ranges->empty());
+        if (is_column_is_null_predicate(predicate)) {
+            return page_index_null_filter(cur_row_ranges, rg_first_row, rg_num_rows).value_or(false);
+        }
         std::vector<std::string> subfield{};
         auto res = _try_to_rewrite_subfield_expr(&pool, predicate, &subfield);
         // rewrite failed, always return false, means no page index happened
@@ -393,7 +467,7 @@ StatusOr<bool> StructColumnReader::page_index_zone_map_filter(const std::vector<
         auto ret = column_reader->page_index_zone_map_filter({rewrite_subfield_predicate}, cur_row_ranges,
                                                              pred_relation, rg_first_row, rg_num_rows);
         // page_index_zone_map_filter failed, always return false, no page index filter happened
-        RETURN_IF(!res.ok(), false);
+        RETURN_IF(!ret.ok(), false);
 
         return ret.value();
     };
@@ -545,7 +619,7 @@ StatusOr<ColumnPredicate*> StructColumnReader::_try_to_rewrite_subfield_expr(
     subfield_output->insert(subfield_output->end(), subfields[0].begin(), subfields[0].end());
 
     // check subfield expr has only one child, and it's a SlotRef
-    if (subfield_expr->children().size() != 1 && !subfield_expr->get_child(0)->is_slotref()) {
+    if (subfield_expr->children().size() != 1 || !subfield_expr->get_child(0)->is_slotref()) {
         return Status::InternalError("Invalid pattern for predicate");
     }
 
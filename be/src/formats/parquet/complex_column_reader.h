@@ -47,6 +47,15 @@ public:
         _element_reader->select_offset_index(range, rg_first_row);
     }
 
+    StatusOr<bool> page_index_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                              SparseRange<uint64_t>* row_ranges, CompoundNodeType pred_relation,
+                                              const uint64_t rg_first_row, const uint64_t rg_num_rows) override;
+
+    StatusOr<bool> page_index_null_filter(SparseRange<uint64_t>* row_ranges, const uint64_t rg_first_row,
+                                          const uint64_t rg_num_rows) override {
+        return _element_reader->page_index_null_filter(row_ranges, rg_first_row, rg_num_rows);
+    }
+
     ColumnReaderPtr& get_element_reader() { return _element_reader; }
 
 private:
@@ -118,6 +127,18 @@ public:
         }
     }
 
+    StatusOr<bool> page_index_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                              SparseRange<uint64_t>* row_ranges, CompoundNodeType pred_relation,
+                                              const uint64_t rg_first_row, const uint64_t rg_num_rows) override;
+
+    StatusOr<bool> page_index_null_filter(SparseRange<uint64_t>* row_ranges, const uint64_t rg_first_row,
+                                          const uint64_t rg_num_rows) override {
+        // all leaf columns of a map contain the null rows of it, prefer the key which is usually smaller
+        ColumnReader* reader = _key_reader != nullptr ? _key_reader.get() : _value_reader.get();
+        RETURN_IF(reader == nullptr, false);
+        return reader->page_index_null_filter(row_ranges, rg_first_row, rg_num_rows);
+    }
+
 private:
     std::unique_ptr<ColumnReader> _key_reader;
     std::unique_ptr<ColumnReader> _value_reader;
@@ -222,6 +243,12 @@ public:
                                               SparseRange<uint64_t>* row_ranges, CompoundNodeType pred_relation,
                                               const uint64_t rg_first_row, const uint64_t rg_num_rows) override;
 
+    StatusOr<bool> page_index_null_filter(SparseRange<uint64_t>* row_ranges, const uint64_t rg_first_row,
+                                          const uint64_t rg_num_rows) override {
+        RETURN_IF(_def_rep_level_child_reader == nullptr, false);
+        return (*_def_rep_level_child_reader)->page_index_null_filter(row_ranges, rg_first_row, rg_num_rows);
+    }
+
     StatusOr<bool> row_group_bloom_filter(const std::vector<const ColumnPredicate*>& predicates,
                                           CompoundNodeType pred_relation, const uint64_t rg_first_row,
                                           const uint64_t rg_num_rows) const override;
@@ -68,6 +68,9 @@ public:
         return Status::NotSupported("get_dict_values is not supported");
     }
 
+    // Average size in bytes of the dictionary values, return 0 if unknown.
+    virtual size_t get_dict_avg_value_size() const { return 0; }
+
     // used to set fixed length
     virtual void set_type_length(int32_t type_length) {}
 
@@ -191,8 +191,8 @@ private:
         T* __restrict__ data = data_column->get_data().data() + cur_size;
 
         if (filter) {
-            _indexes.reserve(count);
-            auto decoded_num = _rle_batch_reader.GetBatch(&_indexes[0], count);
+            raw::stl_vector_resize_uninitialized(&_indexes, count);
+            auto decoded_num = _rle_batch_reader.GetBatch(_indexes.data(), count);
             if (decoded_num < count) {
                 return Status::InternalError("didn't get enough data from dict-decoder");
             }
@@ -314,6 +314,13 @@ public:
         return Status::OK();
     }
 
+    size_t get_dict_avg_value_size() const override {
+        if (_dict.empty()) {
+            return 0;
+        }
+        return (_dict_data.size() - Column::APPEND_OVERFLOW_MAX_SIZE) / _dict.size();
+    }
+
     Status set_data(const Slice& data) override {
         if (data.size > 0) {
             uint8_t bit_width = *data.data;
@@ -343,8 +350,8 @@ private:
 
     Status _next_batch_value(size_t count, Column* dst, const FilterData* filter) override {
         if (filter) {
-            _indexes.reserve(count);
-            auto decoded_num = _rle_batch_reader.GetBatch(&_indexes[0], count);
+            raw::stl_vector_resize_uninitialized(&_indexes, count);
+            auto decoded_num = _rle_batch_reader.GetBatch(_indexes.data(), count);
             if (decoded_num < count) {
                 return Status::InternalError("didn't get enough data from dict-decoder");
             }
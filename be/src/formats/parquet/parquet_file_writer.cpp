@@ -50,7 +50,8 @@ Status ParquetFileWriter::write(Chunk* chunk) {
     if (_rowgroup_writer == nullptr) {
         _rowgroup_writer = std::make_unique<parquet::ChunkWriter>(
                 _writer->AppendBufferedRowGroup(), _type_descs, _schema, _eval_func, _writer_options->time_zone,
-                _writer_options->use_legacy_decimal_encoding, _writer_options->use_int96_timestamp_encoding);
+                _writer_options->use_legacy_decimal_encoding, _writer_options->use_int96_timestamp_encoding,
+                _executors);
     }
 
     RETURN_IF_ERROR(_rowgroup_writer->write(chunk));
@@ -220,7 +221,7 @@ ParquetFileWriter::ParquetFileWriter(std::string location, std::shared_ptr<arrow
                                      std::vector<std::unique_ptr<ColumnEvaluator>>&& column_evaluators,
                                      TCompressionType::type compression_type,
                                      std::shared_ptr<ParquetWriterOptions> writer_options,
-                                     const std::function<void()>& rollback_action)
+                                     const std::function<void()>& rollback_action, PriorityThreadPool* executors)
         : _location(std::move(location)),
           _output_stream(std::move(output_stream)),
           _column_names(std::move(column_names)),
@@ -228,7 +229,8 @@ ParquetFileWriter::ParquetFileWriter(std::string location, std::shared_ptr<arrow
           _column_evaluators(std::move(column_evaluators)),
           _compression_type(compression_type),
           _writer_options(std::move(writer_options)),
-          _rollback_action(std::move(rollback_action)) {}
+          _rollback_action(std::move(rollback_action)),
+          _executors(executors) {}
 
 StatusOr<::parquet::Compression::type> ParquetFileWriter::_convert_compression_type(TCompressionType::type type) {
     ::parquet::Compression::type converted_type;
@@ -495,7 +497,7 @@ StatusOr<WriterAndStream> ParquetFileWriterFactory::create(const std::string& pa
     auto parquet_output_stream = std::make_shared<parquet::AsyncParquetOutputStream>(async_output_stream.get());
     auto writer = std::make_unique<ParquetFileWriter>(path, parquet_output_stream, _column_names, types,
                                                       std::move(column_evaluators), _compression_type, _parsed_options,
-                                                      rollback_action);
+                                                      rollback_action, _executors);
     return WriterAndStream{
             .writer = std::move(writer),
             .stream = std::move(async_output_stream),
@@ -106,7 +106,7 @@ public:
                       std::vector<std::string> column_names, std::vector<TypeDescriptor> type_descs,
                       std::vector<std::unique_ptr<ColumnEvaluator>>&& column_evaluators,
                       TCompressionType::type compression_type, std::shared_ptr<ParquetWriterOptions> writer_options,
-                      const std::function<void()>& rollback_action);
+                      const std::function<void()>& rollback_action, PriorityThreadPool* executors = nullptr);
 
     ~ParquetFileWriter() override;
 
@@ -152,6 +152,8 @@ private:
     std::shared_ptr<::parquet::ParquetFileWriter> _writer;
     std::shared_ptr<parquet::ChunkWriter> _rowgroup_writer;
     const std::function<void()> _rollback_action;
+    // used to encode the columns of a row group in parallel
+    PriorityThreadPool* _executors = nullptr;
 };
 
 class ParquetFileWriterFactory : public FileWriterFactory {
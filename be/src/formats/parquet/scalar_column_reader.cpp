@@ -20,6 +20,7 @@
 #include "formats/parquet/stored_column_reader_with_index.h"
 #include "formats/parquet/utils.h"
 #include "gutil/casts.h"
+#include "gutil/strings/substitute.h"
 #include "io/shared_buffered_input_stream.h"
 #include "runtime/global_dict/dict_column.h"
 #include "runtime/types.h"
@@ -256,31 +257,58 @@ StatusOr<bool> RawColumnReader::_row_group_zone_map_filter(const std::vector<con
     return !PredicateFilterEvaluatorUtils::zonemap_satisfy(predicates, zone_map_detail.value(), pred_relation);
 }
 
-StatusOr<bool> RawColumnReader::_page_index_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
-                                                            SparseRange<uint64_t>* row_ranges,
-                                                            CompoundNodeType pred_relation,
-                                                            const TypeDescriptor& col_type, const uint64_t rg_first_row,
-                                                            const uint64_t rg_num_rows) {
+StatusOr<bool> RawColumnReader::_read_column_index(tparquet::ColumnIndex* column_index) const {
     const tparquet::ColumnChunk* chunk_meta = get_chunk_metadata();
     if (!chunk_meta->__isset.column_index_offset || !chunk_meta->__isset.offset_index_offset ||
         !chunk_meta->__isset.meta_data) {
-        // no page index, dont filter
+        // no page index
         return false;
     }
 
-    // get column index
     int64_t column_index_offset = chunk_meta->column_index_offset;
     uint32_t column_index_length = chunk_meta->column_index_length;
 
-    std::vector<uint8_t> page_index_data;
-    page_index_data.reserve(column_index_length);
+    std::vector<uint8_t> page_index_data(column_index_length);
     RETURN_IF_ERROR(_opts.file->read_at_fully(column_index_offset, page_index_data.data(), column_index_length));
-
-    tparquet::ColumnIndex column_index;
     RETURN_IF_ERROR(deserialize_thrift_msg(page_index_data.data(), &column_index_length, TProtocolType::COMPACT,
-                                           &column_index));
+                                           column_index));
+    return true;
+}
 
+Status RawColumnReader::_select_pages(const Filter& selected, SparseRange<uint64_t>* row_ranges,
+                                      const uint64_t rg_first_row, const uint64_t rg_num_rows) {
     ASSIGN_OR_RETURN(const tparquet::OffsetIndex* offset_index, get_offset_index(rg_first_row));
+    const size_t page_num = selected.size();
+    if (offset_index->page_locations.size() != page_num) {
+        return Status::Corruption(strings::Substitute("page num mismatch, column index: $0, offset index: $1",
+                                                      page_num, offset_index->page_locations.size()));
+    }
+    for (size_t i = 0; i < page_num; i++) {
+        if (selected[i]) {
+            int64_t first_row = offset_index->page_locations[i].first_row_index + rg_first_row;
+            int64_t end_row = first_row;
+            if (i != page_num - 1) {
+                end_row = offset_index->page_locations[i + 1].first_row_index + rg_first_row;
+            } else {
+                end_row = rg_first_row + rg_num_rows;
+            }
+            row_ranges->add(Range<uint64_t>(first_row, end_row));
+        }
+    }
+    return Status::OK();
+}
+
+StatusOr<bool> RawColumnReader::_page_index_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                                            SparseRange<uint64_t>* row_ranges,
+                                                            CompoundNodeType pred_relation,
+                                                            const TypeDescriptor& col_type, const uint64_t rg_first_row,
+                                                            const uint64_t rg_num_rows) {
+    tparquet::ColumnIndex column_index;
+    ASSIGN_OR_RETURN(bool has_page_index, _read_column_index(&column_index));
+    if (!has_page_index) {
+        // no page index, dont filter
+        return false;
+    }
 
     const size_t page_num = column_index.min_values.size();
     const std::vector<bool> null_pages = column_index.null_pages;
@@ -314,7 +342,8 @@ StatusOr<bool> RawColumnReader::_page_index_zone_map_filter(const std::vector<co
             // all null
             zone_map_details.emplace_back(Datum{}, Datum{}, true);
         } else {
-            bool has_null = column_index.null_counts[i] > 0;
+            // null_counts is optional, assume the page has null if it's not set
+            bool has_null = !column_index.__isset.null_counts || column_index.null_counts[i] > 0;
             zone_map_details.emplace_back(min_column->get(i), max_column->get(i), has_null);
         }
     }
@@ -330,18 +359,34 @@ StatusOr<bool> RawColumnReader::_page_index_zone_map_filter(const std::vector<co
         return false;
     }
 
-    for (int i = 0; i < page_num; i++) {
-        if (selected[i]) {
-            int64_t first_row = offset_index->page_locations[i].first_row_index + rg_first_row;
-            int64_t end_row = first_row;
-            if (i != page_num - 1) {
-                end_row = offset_index->page_locations[i + 1].first_row_index + rg_first_row;
-            } else {
-                end_row = rg_first_row + rg_num_rows;
-            }
-            row_ranges->add(Range<uint64_t>(first_row, end_row));
-        }
+    RETURN_IF_ERROR(_select_pages(selected, row_ranges, rg_first_row, rg_num_rows));
+    return true;
+}
+
+StatusOr<bool> RawColumnReader::page_index_null_filter(SparseRange<uint64_t>* row_ranges,
+                                                       const uint64_t rg_first_row, const uint64_t rg_num_rows) {
+    DCHECK(row_ranges->empty());
+    tparquet::ColumnIndex column_index;
+    ASSIGN_OR_RETURN(bool has_page_index, _read_column_index(&column_index));
+    if (!has_page_index || !column_index.__isset.null_counts) {
+        return false;
+    }
+
+    // For nested columns, null_counts counts every leaf slot whose definition level is less than the max
+    // definition level, which includes the null rows of all ancestors. So a page without any null value
+    // does not contain null rows of the top level column.
+    const size_t page_num = column_index.null_counts.size();
+    Filter selected(page_num, 1);
+    for (size_t i = 0; i < page_num; i++) {
+        selected[i] = column_index.null_counts[i] > 0;
+    }
+
+    if (!SIMD::contain_zero(selected)) {
+        // no page has been filtered
+        return false;
     }
+
+    RETURN_IF_ERROR(_select_pages(selected, row_ranges, rg_first_row, rg_num_rows));
     return true;
 }
 
@@ -442,9 +487,9 @@ StatusOr<bool> RawColumnReader::_row_group_bloom_filter(const std::vector<const
 
 Status ScalarColumnReader::read_range(const Range<uint64_t>& range, const Filter* filter, ColumnPtr& dst) {
     DCHECK(get_column_parquet_field()->is_nullable ? dst->is_nullable() : true);
-    _need_lazy_decode =
-            _dict_filter_ctx != nullptr || (_can_lazy_dict_decode && filter != nullptr &&
-                                            SIMD::count_nonzero(*filter) * 1.0 / filter->size() < FILTER_RATIO);
+    _need_lazy_decode = _dict_filter_ctx != nullptr ||
+                        (_can_lazy_dict_decode && filter != nullptr &&
+                         SIMD::count_nonzero(*filter) * 1.0 / filter->size() < _lazy_dict_decode_ratio());
     ColumnContentType content_type = !_need_lazy_decode ? ColumnContentType::VALUE : ColumnContentType::DICT_CODE;
     auto need_lazy_covert = _can_lazy_convert && _converter->need_convert;
     if (_need_lazy_decode) {
@@ -456,6 +501,22 @@ Status ScalarColumnReader::read_range(const Range<uint64_t>& range, const Filter
     }
 }
 
+// Decoding values directly copies the values of all rows, including the rows filtered out later, while lazy
+// decoding reads an extra 4-byte dict code per row and only copies the values of the selected rows. So the
+// longer the dictionary values are, the higher the selectivity under which lazy decoding still pays off.
+double ScalarColumnReader::_lazy_dict_decode_ratio() {
+    if (!_lazy_dict_decode_max_ratio.has_value()) {
+        double ratio = FILTER_RATIO;
+        auto avg_size = _reader->get_dict_avg_value_size();
+        if (avg_size.ok() && avg_size.value() > 0) {
+            constexpr double kDictCodeSize = sizeof(int32_t);
+            ratio = std::max(ratio, 1.0 - kDictCodeSize / avg_size.value());
+        }
+        _lazy_dict_decode_max_ratio = ratio;
+    }
+    return _lazy_dict_decode_max_ratio.value();
+}
+
 bool ScalarColumnReader::try_to_use_dict_filter(ExprContext* ctx, bool is_decode_needed, const SlotId slotId,
                                                 const std::vector<std::string>& sub_field_path, const size_t& layer) {
     if (sub_field_path.size() != layer) {
@@ -108,12 +108,22 @@ public:
 
     void select_offset_index(const SparseRange<uint64_t>& range, const uint64_t rg_first_row) override;
 
+    StatusOr<bool> page_index_null_filter(SparseRange<uint64_t>* row_ranges, const uint64_t rg_first_row,
+                                          const uint64_t rg_num_rows) override;
+
     // Returns true if all of the data pages in the column chunk are dict encoded
     bool column_all_pages_dict_encoded() const;
 
 private:
     Status _init_column_bloom_filter(int32_t offset, int32_t length, BloomFilter& bloom_filter) const;
 
+    // Return false if the column chunk has no page index.
+    StatusOr<bool> _read_column_index(tparquet::ColumnIndex* column_index) const;
+
+    // Add the row ranges of the selected pages into |row_ranges|.
+    Status _select_pages(const Filter& selected, SparseRange<uint64_t>* row_ranges, const uint64_t rg_first_row,
+                         const uint64_t rg_num_rows);
+
 protected:
     StatusOr<bool> _row_group_zone_map_filter(const std::vector<const ColumnPredicate*>& predicates,
                                               CompoundNodeType pred_relation, const TypeDescriptor& col_type,
@@ -205,6 +215,8 @@ private:
 
     Status _dict_decode(ColumnPtr& dst, ColumnPtr& src);
 
+    double _lazy_dict_decode_ratio();
+
     std::unique_ptr<ColumnConverter> _converter;
 
     std::unique_ptr<ColumnDictFilterContext> _dict_filter_ctx;
@@ -215,6 +227,9 @@ private:
     bool _can_lazy_convert = false;
     // we use lazy decode adaptively because of RLE && decoder may be better than filter && decoder
     static constexpr double FILTER_RATIO = 0.2;
+    // the max selectivity under which dict codes are read and only the selected rows are decoded,
+    // initialized by the average size of dictionary values, see `_lazy_dict_decode_ratio`
+    std::optional<double> _lazy_dict_decode_max_ratio;
     bool _need_lazy_decode = false;
     // dict code
     ColumnPtr _tmp_code_column = nullptr;
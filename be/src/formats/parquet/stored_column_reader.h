@@ -75,6 +75,11 @@ public:
 
     virtual Status load_dictionary_page() { return Status::InternalError("Not supported load_dictionary_page"); }
 
+    // Average size in bytes of the dictionary values, return 0 if the column chunk has no dictionary.
+    virtual StatusOr<size_t> get_dict_avg_value_size() {
+        return Status::NotSupported("get_dict_avg_value_size is not supported");
+    }
+
     virtual Status load_specific_page(size_t cur_page_idx, uint64_t offset, uint64_t first_row) {
         return Status::InternalError("Not supported load_specific_page");
     }
@@ -104,6 +109,8 @@ public:
 
     Status load_dictionary_page() override { return _reader->load_dictionary_page(); }
 
+    StatusOr<size_t> get_dict_avg_value_size() override { return _reader->get_dict_avg_value_size(); }
+
     Status load_specific_page(size_t cur_page_idx, uint64_t offset, uint64_t first_row) override;
 
     void set_page_num(size_t page_num) override { _reader->set_page_num(page_num); }
@@ -65,6 +65,15 @@ public:
         return _inner_reader->get_dict_values(dict_codes, nulls, column);
     }
 
+    StatusOr<size_t> get_dict_avg_value_size() override {
+        RETURN_IF(!_has_dict_page, 0);
+        if (!_dict_page_loaded) {
+            RETURN_IF_ERROR(_inner_reader->load_dictionary_page());
+            _dict_page_loaded = true;
+        }
+        return _inner_reader->get_dict_avg_value_size();
+    }
+
 private:
     std::unique_ptr<StoredColumnReader> _inner_reader;
     ColumnOffsetIndexCtx* _offset_index_ctx;
@@ -22,7 +22,9 @@ namespace starrocks::parquet {
 enum ColumnContentType { VALUE, DICT_CODE };
 
 enum ColumnIOType { INVALID = 0, PAGE_INDEX = 1, PAGES = 2, BLOOM_FILTER = 4 };
-enum CacheType { META, PAGE };
+// The file caches of external tables share one cache, the type prefix of the key tells them apart. ORC_FILE_TAIL is
+// the serialized file tail of orc files.
+enum CacheType { META, PAGE, ORC_FILE_TAIL };
 
 using ColumnIOTypeFlags = int32_t;
 
@@ -42,7 +44,7 @@ public:
                                           uint64_t file_size);
 
 private:
-    inline static const std::vector<std::string> cache_key_prefix{"ft", "pg"};
+    inline static const std::vector<std::string> cache_key_prefix{"ft", "pg", "ot"};
 };
 
 } // namespace starrocks::parquet
@@ -85,6 +85,12 @@ void QueryCacheAction::_handle_stat(HttpRequest* req) {
         root.AddMember("lookup_count", rapidjson::Value(lookup_count), allocator);
         root.AddMember("hit_count", rapidjson::Value(hit_count), allocator);
         root.AddMember("hit_ratio", rapidjson::Value(hit_ratio), allocator);
+        if (cache_mgr->has_disk_tier()) {
+            root.AddMember("disk_capacity", rapidjson::Value(cache_mgr->disk_capacity()), allocator);
+            root.AddMember("disk_usage", rapidjson::Value(cache_mgr->disk_usage()), allocator);
+            root.AddMember("disk_lookup_count", rapidjson::Value(cache_mgr->disk_lookup_count()), allocator);
+            root.AddMember("disk_hit_count", rapidjson::Value(cache_mgr->disk_hit_count()), allocator);
+        }
     });
 }
 
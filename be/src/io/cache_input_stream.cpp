@@ -427,6 +427,19 @@ int64_t CacheInputStream::get_align_size() const {
     return _block_size;
 }
 
+bool CacheInputStream::is_cached(int64_t offset, int64_t size) const {
+    if (_block_size <= 0 || !_cache->available()) {
+        return false;
+    }
+    int64_t end = std::min(offset + size, _size);
+    for (int64_t block_offset = offset / _block_size * _block_size; block_offset < end; block_offset += _block_size) {
+        if (!_cache->exist(_cache_key, block_offset, std::min(_block_size, _size - block_offset))) {
+            return false;
+        }
+    }
+    return true;
+}
+
 StatusOr<std::string_view> CacheInputStream::peek(int64_t count) {
     // if app level uses zero copy read, it does bypass the cache layer.
     // so here we have to fill cache manually.
@@ -88,6 +88,9 @@ public:
 
     int64_t get_align_size() const;
 
+    // Whether all blocks covering [offset, offset + size) are in the local block cache.
+    bool is_cached(int64_t offset, int64_t size) const;
+
     StatusOr<std::string_view> peek(int64_t count) override;
 
     Status skip(int64_t count) override {
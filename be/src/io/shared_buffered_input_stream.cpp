@@ -38,6 +38,16 @@ void SharedBufferedInputStream::SharedBuffer::align(int64_t align_size, int64_t
     }
 }
 
+SharedBufferedInputStream::CoalesceOptions SharedBufferedInputStream::CoalesceOptions::from_io_cost(
+        int64_t latency_us, int64_t bandwidth_mb_per_sec, int64_t max_buffer_size) {
+    CoalesceOptions options;
+    options.max_buffer_size = std::max<int64_t>(max_buffer_size, 0);
+    // bytes that can be read within the latency of a request
+    int64_t dist = std::max<int64_t>(latency_us, 0) * std::max<int64_t>(bandwidth_mb_per_sec, 0) * MB / 1000000;
+    options.max_dist_size = std::min(dist, options.max_buffer_size);
+    return options;
+}
+
 std::string SharedBufferedInputStream::SharedBuffer::debug_string() const {
     return strings::Substitute(
             "SharedBuffer raw_offset=$0, raw_size=$1, offset=$2, size=$3, ref_count=$4, buffer_capacity=$5", raw_offset,
@@ -66,6 +76,21 @@ Status SharedBufferedInputStream::_sort_and_check_overlap(std::vector<IORange>&
     return Status::OK();
 }
 
+void SharedBufferedInputStream::_remove_cached_ranges(std::vector<IORange>* ranges) {
+    if (!_cached_range_checker) {
+        return;
+    }
+    auto iter = std::remove_if(ranges->begin(), ranges->end(), [&](const IORange& r) {
+        if (r.size == 0 || !_cached_range_checker(r.offset, r.size)) {
+            return false;
+        }
+        _skipped_cached_io_count += 1;
+        _skipped_cached_io_bytes += r.size;
+        return true;
+    });
+    ranges->erase(iter, ranges->end());
+}
+
 void SharedBufferedInputStream::_merge_small_ranges(const std::vector<IORange>& small_ranges) {
     if (small_ranges.size() > 0) {
         auto update_map = [&](size_t from, size_t to) {
@@ -104,6 +129,7 @@ Status SharedBufferedInputStream::_set_io_ranges_all_columns(const std::vector<I
 
     std::vector<IORange> check(ranges);
     RETURN_IF_ERROR(_sort_and_check_overlap(check));
+    _remove_cached_ranges(&check);
 
     std::vector<IORange> small_ranges;
     for (const IORange& r : check) {
@@ -130,10 +156,10 @@ Status SharedBufferedInputStream::_set_io_ranges_active_and_lazy_columns(const s
     // If we don't specify compare function, we may have [351,356],[351,351] which is bad order.
     std::vector<IORange> check(ranges);
     RETURN_IF_ERROR(_sort_and_check_overlap(check));
+    _remove_cached_ranges(&check);
 
     std::vector<IORange> small_active_ranges;
-    std::vector<bool> small_lazy_flag(ranges.size());
-    small_lazy_flag.assign(ranges.size(), false);
+    std::vector<bool> small_lazy_flag(check.size(), false);
     for (auto index = 0; index < check.size(); ++index) {
         const IORange& r = check[index];
         if (r.size > _options.max_buffer_size) {
@@ -16,6 +16,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 
 #include "common/status.h"
@@ -37,7 +38,15 @@ public:
         static constexpr int64_t MB = 1024 * 1024;
         int64_t max_dist_size = 1 * MB;
         int64_t max_buffer_size = 8 * MB;
+
+        // Derive the options from the cost of a request to the underlying storage: reading the gap between two
+        // ranges is cheaper than issuing one more request as long as the gap can be read within the latency
+        // of a request, so the max distance is `latency * bandwidth`, capped by |max_buffer_size|.
+        static CoalesceOptions from_io_cost(int64_t latency_us, int64_t bandwidth_mb_per_sec, int64_t max_buffer_size);
     };
+    // Returns true if the range [offset, offset + size) can be read without accessing the underlying stream,
+    // e.g. all blocks of the range are resident in the block cache.
+    using CachedRangeChecker = std::function<bool(int64_t offset, int64_t size)>;
     struct SharedBuffer {
         // request range
         int64_t raw_offset;
@@ -81,6 +90,9 @@ public:
     void release_to_offset(int64_t offset);
     void release();
     void set_coalesce_options(const CoalesceOptions& options) { _options = options; }
+    // Ranges that are cached when `set_io_ranges` is called are not coalesced into shared buffers, so that
+    // they do not extend or add reads to the underlying stream. They are read directly if the cache is missed.
+    void set_cached_range_checker(CachedRangeChecker checker) { _cached_range_checker = std::move(checker); }
     void set_align_size(int64_t size) { _align_size = size; }
 
     int64_t shared_io_count() const { return _shared_io_count; }
@@ -90,6 +102,8 @@ public:
     int64_t direct_io_count() const { return _direct_io_count; }
     int64_t direct_io_bytes() const { return _direct_io_bytes; }
     int64_t direct_io_timer() const { return _direct_io_timer; }
+    int64_t skipped_cached_io_count() const { return _skipped_cached_io_count; }
+    int64_t skipped_cached_io_bytes() const { return _skipped_cached_io_bytes; }
     int64_t estimated_mem_usage() const { return _estimated_mem_usage; }
     // each SharedBuffer may contain several ranges, the return the ref sum
     int64_t current_range_ref_sum() const;
@@ -102,6 +116,7 @@ public:
 private:
     void _update_estimated_mem_usage();
     Status _sort_and_check_overlap(std::vector<IORange>& ranges);
+    void _remove_cached_ranges(std::vector<IORange>* ranges);
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
     Status _set_io_ranges_active_and_lazy_columns(const std::vector<IORange>& ranges);
@@ -109,6 +124,7 @@ private:
     const std::string _filename;
     std::map<int64_t, SharedBufferPtr> _map;
     CoalesceOptions _options;
+    CachedRangeChecker _cached_range_checker;
     int64_t _offset = 0;
     int64_t _file_size = 0;
     int64_t _shared_io_count = 0;
@@ -118,6 +134,8 @@ private:
     int64_t _direct_io_count = 0;
     int64_t _direct_io_bytes = 0;
     int64_t _direct_io_timer = 0;
+    int64_t _skipped_cached_io_count = 0;
+    int64_t _skipped_cached_io_bytes = 0;
     int64_t _align_size = 0;
     int64_t _estimated_mem_usage = 0;
 };
@@ -697,6 +697,8 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
     std::unique_ptr<ThreadPool> load_rowset_pool;
     std::unique_ptr<ThreadPool> load_segment_pool;
     std::unique_ptr<ThreadPool> put_combined_txn_log_thread_pool;
+    std::unique_ptr<ThreadPool> load_txn_log_thread_pool;
+    std::unique_ptr<ThreadPool> lake_vacuum_tablet_thread_pool;
     RETURN_IF_ERROR(
             ThreadPoolBuilder("load_rowset_pool")
                     .set_min_threads(0)
@@ -724,6 +726,20 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .build(&put_combined_txn_log_thread_pool));
     _put_combined_txn_log_thread_pool = put_combined_txn_log_thread_pool.release();
 
+    RETURN_IF_ERROR(ThreadPoolBuilder("load_txn_log_thread_pool")
+                            .set_min_threads(0)
+                            .set_max_threads(config::load_txn_log_thread_pool_num_max)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(500))
+                            .build(&load_txn_log_thread_pool));
+    _load_txn_log_thread_pool = load_txn_log_thread_pool.release();
+
+    RETURN_IF_ERROR(ThreadPoolBuilder("lake_vacuum_tablet")
+                            .set_min_threads(0)
+                            .set_max_threads(config::lake_vacuum_tablet_thread_pool_num_max)
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(500))
+                            .build(&lake_vacuum_tablet_thread_pool));
+    _lake_vacuum_tablet_thread_pool = lake_vacuum_tablet_thread_pool.release();
+
 #ifndef BE_TEST
     _bfd_parser = BfdParser::create();
 #endif
@@ -807,12 +823,16 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
     RETURN_IF_ERROR(_load_channel_mgr->init(GlobalEnv::GetInstance()->load_mem_tracker()));
 
     _heartbeat_flags = new HeartbeatFlags();
-    auto capacity = std::max<size_t>(config::query_cache_capacity, 4L * 1024 * 1024);
-    _cache_mgr = new query_cache::CacheManager(capacity);
 
     _spill_dir_mgr = std::make_shared<spill::DirManager>();
     RETURN_IF_ERROR(_spill_dir_mgr->init(config::spill_local_storage_dir));
 
+    auto capacity = std::max<size_t>(config::query_cache_capacity, 4L * 1024 * 1024);
+    _cache_mgr = new query_cache::CacheManager(capacity);
+    if (config::query_cache_disk_capacity > 0) {
+        RETURN_IF_ERROR(_cache_mgr->enable_disk_tier(_spill_dir_mgr.get(), config::query_cache_disk_capacity));
+    }
+
     _diagnose_daemon = new DiagnoseDaemon();
     RETURN_IF_ERROR(_diagnose_daemon->init());
 #ifdef STARROCKS_JIT_ENABLE
@@ -986,6 +1006,8 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_lake_replication_txn_manager);
     SAFE_DELETE(_cache_mgr);
     SAFE_DELETE(_put_combined_txn_log_thread_pool);
+    SAFE_DELETE(_load_txn_log_thread_pool);
+    SAFE_DELETE(_lake_vacuum_tablet_thread_pool);
     SAFE_DELETE(_diagnose_daemon);
     _dictionary_cache_pool.reset();
     _automatic_partition_pool.reset();
@@ -331,6 +331,8 @@ public:
     ThreadPool* load_rowset_thread_pool() { return _load_rowset_thread_pool; }
     ThreadPool* load_segment_thread_pool() { return _load_segment_thread_pool; }
     ThreadPool* put_combined_txn_log_thread_pool() { return _put_combined_txn_log_thread_pool; }
+    ThreadPool* load_txn_log_thread_pool() { return _load_txn_log_thread_pool; }
+    ThreadPool* lake_vacuum_tablet_thread_pool() { return _lake_vacuum_tablet_thread_pool; }
 
     pipeline::DriverExecutor* wg_driver_executor();
     workgroup::ScanExecutor* scan_executor();
@@ -424,6 +426,8 @@ private:
     ThreadPool* _load_segment_thread_pool = nullptr;
     ThreadPool* _load_rowset_thread_pool = nullptr;
     ThreadPool* _put_combined_txn_log_thread_pool = nullptr;
+    ThreadPool* _load_txn_log_thread_pool = nullptr;
+    ThreadPool* _lake_vacuum_tablet_thread_pool = nullptr;
 
     PriorityThreadPool* _udf_call_pool = nullptr;
     PriorityThreadPool* _pipeline_prepare_pool = nullptr;
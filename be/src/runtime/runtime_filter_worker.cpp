@@ -39,6 +39,7 @@
 #include "util/defer_op.h"
 #include "util/internal_service_recoverable_stub.h"
 #include "util/metrics.h"
+#include "util/stopwatch.hpp"
 #include "util/thread.h"
 #include "util/time.h"
 
@@ -323,8 +324,12 @@ Status RuntimeFilterMergerStatus::_merge_skew_broadcast_runtime_filter(RuntimeFi
 }
 
 RuntimeFilterMerger::RuntimeFilterMerger(ExecEnv* env, const UniqueId& query_id, const TQueryOptions& query_options,
-                                         bool is_pipeline)
-        : _exec_env(env), _query_id(query_id), _query_options(query_options), _is_pipeline(is_pipeline) {}
+                                         bool is_pipeline, RuntimeFilterWorkerMetrics* metrics)
+        : _exec_env(env),
+          _query_id(query_id),
+          _query_options(query_options),
+          _is_pipeline(is_pipeline),
+          _metrics(metrics) {}
 
 Status RuntimeFilterMerger::init(const TRuntimeFilterParams& params) {
     _targets = params.id_to_prober_params;
@@ -385,10 +390,15 @@ void RuntimeFilterMerger::merge_runtime_filter(PTransmitRuntimeFilterParams& par
     status->recv_last_filter_ts = now;
 
     // to merge runtime filters
+    MonotonicStopWatch watch;
+    watch.start();
     ObjectPool* pool = &(status->pool);
     RuntimeFilter* rf = nullptr;
     int rf_version = RuntimeFilterHelper::deserialize_runtime_filter(
             pool, &rf, reinterpret_cast<const uint8_t*>(params.data().data()), params.data().size());
+    if (_metrics != nullptr) {
+        _metrics->update_merge(watch.elapsed_time(), params.data().size());
+    }
     if (rf == nullptr) {
         // something wrong with deserialization.
         return;
@@ -495,6 +505,34 @@ void RuntimeFilterMerger::store_skew_broadcast_join_runtime_filter(PTransmitRunt
     _send_total_runtime_filter(rf_version, filter_id);
 }
 
+std::vector<std::pair<size_t, size_t>> split_runtime_filter_broadcast_tree(size_t num_targets, size_t fanout,
+                                                                           bool first_no_forward) {
+    std::vector<std::pair<size_t, size_t>> subtrees;
+    size_t index = 0;
+    if (first_no_forward && num_targets > 0) {
+        subtrees.emplace_back(0, 1);
+        index = 1;
+    }
+    if (fanout == 0) {
+        while (index < num_targets) {
+            // forward [index+1, index+1+half) to [index]
+            size_t half = (num_targets - index) / 2;
+            subtrees.emplace_back(index, index + 1 + half);
+            index += (1 + half);
+        }
+        return subtrees;
+    }
+    size_t remaining = num_targets - index;
+    size_t num_subtrees = std::min(fanout, remaining);
+    for (size_t i = 0; i < num_subtrees; i++) {
+        // the first (remaining % num_subtrees) subtrees take one more destination.
+        size_t subtree_size = remaining / num_subtrees + (i < remaining % num_subtrees ? 1 : 0);
+        subtrees.emplace_back(index, index + subtree_size);
+        index += subtree_size;
+    }
+    return subtrees;
+}
+
 struct BatchClosuresJoinAndClean {
 public:
     BatchClosuresJoinAndClean(RuntimeFilterRpcClosures& closures) : _closures(closures) {}
@@ -538,6 +576,8 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
     DCHECK(target_it != _targets.end());
     std::vector<TRuntimeFilterProberParams>* target_nodes = &(target_it->second);
 
+    MonotonicStopWatch watch;
+    watch.start();
     RuntimeFilter* out = nullptr;
     RuntimeFilter* first = status->filters.begin()->second;
     ObjectPool* pool = &(status->pool);
@@ -589,6 +629,9 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
     size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(rf_version, out,
                                                                        reinterpret_cast<uint8_t*>(send_data->data()));
     send_data->resize(actual_size);
+    if (_metrics != nullptr) {
+        _metrics->update_merge(watch.elapsed_time(), 0);
+    }
     int timeout_ms = config::send_rpc_runtime_filter_timeout_ms;
     if (_query_options.__isset.runtime_filter_send_timeout_ms) {
         timeout_ms = _query_options.runtime_filter_send_timeout_ms;
@@ -640,15 +683,19 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
         }
     }
 
-    size_t index = 0;
-    size_t size = targets.size();
+    bool first_is_local = !targets.empty() && targets[0].first == local;
+    auto subtrees =
+            split_runtime_filter_broadcast_tree(targets.size(), config::runtime_filter_broadcast_tree_fanout,
+                                                // if X->X, and we split into two half [A, B]
+                                                // then in next step,  X->A, and X->B, which is in-efficient
+                                                // so if X->X, we don't do split.
+                                                first_is_local);
 
     RuntimeFilterRpcClosures rpc_closures;
-    rpc_closures.reserve(size);
+    rpc_closures.reserve(subtrees.size());
     BatchClosuresJoinAndClean join_and_clean(rpc_closures);
-    while (index < size) {
-        auto& t = targets[index];
-        bool is_local = (local == t.first);
+    for (const auto& [begin, end] : subtrees) {
+        auto& t = targets[begin];
         request.clear_probe_finst_ids();
         request.clear_forward_targets();
         for (const auto& inst : t.second) {
@@ -658,16 +705,10 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
         }
 
         // add forward targets.
-        // forward [index+1, index+1+half) to [index]
-        size_t half = (size - index) / 2;
-        // if X->X, and we split into two half [A, B]
-        // then in next step,  X->A, and X->B, which is in-efficient
-        // so if X->X, we don't do split.
-        if (is_local) {
-            half = 0;
-        }
-        for (size_t i = 0; i < half; i++) {
-            auto& ft = targets[index + 1 + i];
+        // forward [begin+1, end) to [begin]
+        size_t num_forwards = end - begin - 1;
+        for (size_t i = begin + 1; i < end; i++) {
+            auto& ft = targets[i];
             PTransmitRuntimeFilterForwardTarget* fwd = request.add_forward_targets();
             fwd->set_host(ft.first.hostname);
             fwd->set_port(ft.first.port);
@@ -678,13 +719,15 @@ void RuntimeFilterMerger::_send_total_runtime_filter(int rf_version, int32_t fil
             }
         }
 
-        if (half != 0) {
-            VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter. target " << t.first << " will forward to " << half
-                      << " nodes. nodes[0] = " << request.forward_targets(0).DebugString();
+        if (num_forwards != 0) {
+            VLOG_FILE << "RuntimeFilterMerger::merge_runtime_filter. target " << t.first << " will forward to "
+                      << num_forwards << " nodes. nodes[0] = " << request.forward_targets(0).DebugString();
         }
 
-        index += (1 + half);
         _exec_env->add_rf_event({request.query_id(), request.filter_id(), t.first.hostname, "SEND_TOTAL_RF_RPC"});
+        if (_metrics != nullptr) {
+            _metrics->update_broadcast_tree_bytes(false, request.data().size());
+        }
         rpc_closures.push_back(new RuntimeFilterRpcClosure);
         auto* closure = rpc_closures.back();
         closure->ref();
@@ -942,13 +985,13 @@ void RuntimeFilterWorker::_receive_total_runtime_filter(PTransmitRuntimeFilterPa
         targets.emplace_back(fwd);
     }
 
-    size_t index = 0;
+    auto subtrees = split_runtime_filter_broadcast_tree(size, config::runtime_filter_broadcast_tree_fanout, false);
     RuntimeFilterRpcClosures rpc_closures;
-    rpc_closures.reserve(size);
+    rpc_closures.reserve(subtrees.size());
     BatchClosuresJoinAndClean join_and_clean(rpc_closures);
 
-    while (index < size) {
-        auto& t = targets[index];
+    for (const auto& [begin, end] : subtrees) {
+        auto& t = targets[begin];
         TNetworkAddress addr;
         addr.hostname = t.host();
         addr.port = t.port();
@@ -961,19 +1004,19 @@ void RuntimeFilterWorker::_receive_total_runtime_filter(PTransmitRuntimeFilterPa
         }
 
         // add forward targets.
-        size_t half = (size - index) / 2;
-        for (size_t i = 0; i < half; i++) {
+        size_t num_forwards = end - begin - 1;
+        for (size_t i = begin + 1; i < end; i++) {
             PTransmitRuntimeFilterForwardTarget* fwd = request.add_forward_targets();
-            *fwd = targets[index + 1 + i];
+            *fwd = targets[i];
         }
 
-        if (half != 0) {
-            VLOG_FILE << "RuntimeFilterWorker::receive_total_rf. target " << addr << " will forward to " << half
-                      << " nodes. nodes[0] = " << request.forward_targets(0).DebugString();
+        if (num_forwards != 0) {
+            VLOG_FILE << "RuntimeFilterWorker::receive_total_rf. target " << addr << " will forward to "
+                      << num_forwards << " nodes. nodes[0] = " << request.forward_targets(0).DebugString();
         }
 
-        index += (1 + half);
         _exec_env->add_rf_event({request.query_id(), request.filter_id(), addr.hostname, "FORWARD"});
+        _metrics->update_broadcast_tree_bytes(true, request.data().size());
         rpc_closures.push_back(new RuntimeFilterRpcClosure());
         auto* closure = rpc_closures.back();
         closure->ref();
@@ -1150,7 +1193,8 @@ void RuntimeFilterWorker::execute() {
                 VLOG_QUERY << "open query: rf merger already existed. query_id = " << ev.query_id;
                 break;
             }
-            RuntimeFilterMerger merger(_exec_env, UniqueId(ev.query_id), ev.query_options, ev.is_opened_by_pipeline);
+            RuntimeFilterMerger merger(_exec_env, UniqueId(ev.query_id), ev.query_options, ev.is_opened_by_pipeline,
+                                       _metrics);
             Status st = merger.init(ev.create_rf_merger_request);
             if (!st.ok()) {
                 VLOG_QUERY << "open query: rf merger initialization failed. error = " << st.message();
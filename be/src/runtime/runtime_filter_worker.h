@@ -17,6 +17,7 @@
 #include <column/column.h>
 #include <types/logical_type.h>
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <map>
@@ -79,6 +80,8 @@ struct SkewBroadcastRfMaterial {
     ColumnPtr key_column;
 };
 
+struct RuntimeFilterWorkerMetrics;
+
 class RuntimeFilterMergerStatus {
 public:
     RuntimeFilterMergerStatus() = default;
@@ -126,7 +129,8 @@ public:
 // and sent merged RF to consumer nodes.
 class RuntimeFilterMerger {
 public:
-    RuntimeFilterMerger(ExecEnv* env, const UniqueId& query_id, const TQueryOptions& query_options, bool is_pipeline);
+    RuntimeFilterMerger(ExecEnv* env, const UniqueId& query_id, const TQueryOptions& query_options, bool is_pipeline,
+                        RuntimeFilterWorkerMetrics* metrics = nullptr);
     Status init(const TRuntimeFilterParams& params);
     void merge_runtime_filter(PTransmitRuntimeFilterParams& params);
     void store_skew_broadcast_join_runtime_filter(PTransmitRuntimeFilterParams& params);
@@ -140,8 +144,19 @@ private:
     UniqueId _query_id;
     TQueryOptions _query_options;
     const bool _is_pipeline;
+    RuntimeFilterWorkerMetrics* _metrics;
 };
 
+// Split `num_targets` destinations of a total RF into subtrees, each of them is a [begin, end) range of
+// destinations. The head of each subtree receives the RF directly and forwards it to the rest of the subtree.
+// - fanout == 0: binomial tree, the sender forwards half of the remaining destinations to each head, which is
+//   the legacy behavior.
+// - fanout > 0: the remaining destinations are split into at most `fanout` subtrees of balanced size, so the
+//   depth of the broadcast tree is O(log_fanout(n)) and every node sends at most `fanout` RPCs.
+// If `first_no_forward` is true, the first destination is a subtree by itself(i.e. the local BE).
+std::vector<std::pair<size_t, size_t>> split_runtime_filter_broadcast_tree(size_t num_targets, size_t fanout,
+                                                                           bool first_no_forward);
+
 enum EventType {
     RECEIVE_TOTAL_RF = 0,
     CLOSE_QUERY = 1,
@@ -202,8 +217,28 @@ struct RuntimeFilterWorkerMetrics {
         return total;
     }
 
+    void update_broadcast_tree_bytes(bool is_forward, int64_t delta) {
+        if (is_forward) {
+            broadcast_tree_forward_bytes += delta;
+        } else {
+            broadcast_tree_root_bytes += delta;
+        }
+    }
+
+    void update_merge(int64_t latency_ns, int64_t bytes) {
+        merge_latency_ns += latency_ns;
+        merge_bytes += bytes;
+    }
+
     std::array<std::atomic_int64_t, EventType::MAX_COUNT> event_nums{};
     std::array<std::atomic_int64_t, EventType::MAX_COUNT> runtime_filter_bytes{};
+    // time spent by merge nodes on deserializing the partitioned RFs, concating and serializing them into total RFs,
+    // and bytes of the partitioned RFs they received.
+    std::atomic_int64_t merge_latency_ns{0};
+    std::atomic_int64_t merge_bytes{0};
+    // bytes of total RF sent by merge nodes(root) and forwarded by the inner nodes of broadcast tree.
+    std::atomic_int64_t broadcast_tree_root_bytes{0};
+    std::atomic_int64_t broadcast_tree_forward_bytes{0};
 };
 
 class RuntimeFilterWorker {
@@ -498,9 +498,9 @@ public:
     // CompilableExprType
     // arithmetic -> 2, except /, %
     // cast -> 4
-    // case -> 8
-    // cmp -> 16
-    // logical -> 32
+    // case -> 8, including if, ifnull, nullif and coalesce
+    // cmp -> 16, including in
+    // logical -> 32, including is null and is not null
     // div -> 64
     // mod -> 128
     bool can_jit_expr(const int jit_label) {
@@ -73,6 +73,10 @@ inline bool is_sst(std::string_view file_name) {
     return HasSuffixString(file_name, ".sst");
 }
 
+inline bool is_segment_meta_bundle(std::string_view file_name) {
+    return HasSuffixString(file_name, ".smb");
+}
+
 inline std::string tablet_metadata_filename(int64_t tablet_id, int64_t version) {
     return fmt::format("{:016X}_{:016X}.meta", tablet_id, version);
 }
@@ -122,6 +126,27 @@ inline std::string gen_segment_filename(int64_t txn_id) {
     return fmt::format("{:016x}_{}.dat", txn_id, generate_uuid_string());
 }
 
+// The segment meta bundle of a rowset is named after the first segment of the rowset.
+inline std::string segment_meta_bundle_filename(std::string_view first_segment_name) {
+    if (HasSuffixString(first_segment_name, ".dat")) {
+        first_segment_name.remove_suffix(4);
+    }
+    return fmt::format("{}.smb", first_segment_name);
+}
+
+// Return the name of the segment meta bundle which may be written for the segments of a rowset starting from
+// |offset|(the new segments of a compaction output rowset), or an empty string if no bundle is written for them.
+// Paths deleting the segments of a rowset delete the bundle as well while config::lake_enable_segment_meta_bundle
+// is on, otherwise they would issue a delete for every multi-segment rowset.
+template <typename Segments>
+inline std::string rowset_segment_meta_bundle_filename(const Segments& segments, int offset = 0) {
+    // bundles are only written for rowsets with more than one segment
+    if (offset < 0 || static_cast<size_t>(offset) + 2 > static_cast<size_t>(segments.size())) {
+        return {};
+    }
+    return segment_meta_bundle_filename(segments[offset]);
+}
+
 inline std::string gen_cols_filename(int64_t txn_id) {
     return fmt::format("{:016x}_{}.cols", txn_id, generate_uuid_string());
 }
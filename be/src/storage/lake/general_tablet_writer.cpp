@@ -61,6 +61,7 @@ Status HorizontalGeneralTabletWriter::flush(SegmentPB* segment) {
 
 Status HorizontalGeneralTabletWriter::finish(SegmentPB* segment) {
     RETURN_IF_ERROR(flush_segment_writer(segment));
+    write_segment_meta_bundle();
     _finished = true;
     return Status::OK();
 }
@@ -114,6 +115,7 @@ Status HorizontalGeneralTabletWriter::flush_segment_writer(SegmentPB* segment) {
         RETURN_IF_ERROR(_seg_writer->finalize(&segment_size, &index_size, &footer_position));
         const std::string& segment_path = _seg_writer->segment_path();
         std::string segment_name = std::string(basename(segment_path));
+        add_segment_footer(segment_name, *_seg_writer);
         _files.emplace_back(FileInfo{segment_name, segment_size, _seg_writer->encryption_meta()});
         _data_size += segment_size;
         _stats.bytes_write += segment_size;
@@ -249,6 +251,7 @@ Status VerticalGeneralTabletWriter::finish(SegmentPB* segment) {
         RETURN_IF_ERROR(segment_writer->finalize_footer(&segment_size, &footer_position));
         const std::string& segment_path = segment_writer->segment_path();
         std::string segment_name = std::string(basename(segment_path));
+        add_segment_footer(segment_name, *segment_writer);
         _files.emplace_back(FileInfo{segment_name, segment_size, segment_writer->encryption_meta()});
         _data_size += segment_size;
         _stats.bytes_write += segment_size;
@@ -259,6 +262,7 @@ Status VerticalGeneralTabletWriter::finish(SegmentPB* segment) {
     if (_segment_writer_finalize_token != nullptr) {
         _segment_writer_finalize_token.reset();
     }
+    write_segment_meta_bundle();
     _finished = true;
     return Status::OK();
 }
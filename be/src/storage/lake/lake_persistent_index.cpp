@@ -14,8 +14,11 @@
 
 #include "storage/lake/lake_persistent_index.h"
 
+#include <deque>
+
 #include "fs/fs_util.h"
 #include "fs/key_cache.h"
+#include "runtime/current_thread.h"
 #include "serde/column_array_serde.h"
 #include "storage/chunk_helper.h"
 #include "storage/lake/filenames.h"
@@ -31,6 +34,9 @@
 #include "storage/sstable/merger.h"
 #include "storage/sstable/options.h"
 #include "storage/sstable/table_builder.h"
+#include "util/countdown_latch.h"
+#include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 
 namespace starrocks::lake {
@@ -123,7 +129,11 @@ void KeyValueMerger::flush() {
         value->set_rowid(index_value_with_ver.second.get_rowid());
     }
     if (index_value_pb.values_size() > 0) {
-        _builder->Add(Slice(_key), Slice(index_value_pb.SerializeAsString()));
+        if (_builder != nullptr) {
+            _builder->Add(Slice(_key), Slice(index_value_pb.SerializeAsString()));
+        } else {
+            _output->emplace_back(_key, index_value_pb.SerializeAsString());
+        }
     }
     _index_value_vers.clear();
 }
@@ -151,7 +161,8 @@ Status LakePersistentIndex::init(const PersistentIndexSstableMetaPB& sstable_met
             return Status::InternalError("Block cache is null.");
         }
         auto sstable = std::make_unique<PersistentIndexSstable>();
-        RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+        RETURN_IF_ERROR(
+                sstable->init(std::move(rf), sstable_pb, block_cache->cache(), true, block_cache->prefetch_pool()));
         _sstables.emplace_back(std::move(sstable));
         max_rss_rowid = std::max(max_rss_rowid, sstable_pb.max_rss_rowid());
     }
@@ -215,7 +226,7 @@ Status LakePersistentIndex::minor_compact() {
     if (block_cache == nullptr) {
         return Status::InternalError("Block cache is null.");
     }
-    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache(), true, block_cache->prefetch_pool()));
     _sstables.emplace_back(std::move(sstable));
     TRACE_COUNTER_INCREMENT("minor_compact_times", 1);
     return Status::OK();
@@ -442,6 +453,137 @@ Status LakePersistentIndex::merge_sstables(std::unique_ptr<sstable::Iterator> it
     return builder->Finish();
 }
 
+std::vector<std::string> LakePersistentIndex::split_key_ranges(
+        const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables, size_t max_ranges) {
+    std::vector<std::string> split_keys;
+    if (max_ranges <= 1) {
+        return split_keys;
+    }
+    // Each index entry stands for one data block, so index keys sampled at the same step over all sstables
+    // are evenly distributed by data size.
+    static constexpr size_t kSamplesPerRange = 16;
+    const size_t block_size = sstable::Options().block_size;
+    size_t total_blocks = 0;
+    for (const auto& sst : sstables) {
+        total_blocks += sst->sstable_pb().filesize() / block_size + 1;
+    }
+    const size_t step = std::max<size_t>(1, total_blocks / (max_ranges * kSamplesPerRange));
+    std::vector<std::string> samples;
+    for (const auto& sst : sstables) {
+        std::unique_ptr<sstable::Iterator> iter(sst->new_index_iterator());
+        size_t i = 0;
+        for (iter->SeekToFirst(); iter->Valid(); iter->Next(), i++) {
+            if (i % step == 0) {
+                samples.emplace_back(iter->key().to_string());
+            }
+        }
+    }
+    std::sort(samples.begin(), samples.end());
+    for (size_t r = 1; r < max_ranges && !samples.empty(); r++) {
+        const auto& key = samples[r * samples.size() / max_ranges];
+        // empty key stands for unbounded, and split keys must be strictly increasing.
+        if (!key.empty() && (split_keys.empty() || split_keys.back() < key)) {
+            split_keys.emplace_back(key);
+        }
+    }
+    return split_keys;
+}
+
+Status LakePersistentIndex::merge_key_range(const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables,
+                                            const std::string& lower, const std::string& upper, bool base_level_merge,
+                                            std::vector<std::pair<std::string, std::string>>* output) {
+    sstable::ReadOptions read_options;
+    // No need to cache input sst's blocks.
+    read_options.fill_cache = false;
+    std::vector<sstable::Iterator*> iters;
+    iters.reserve(sstables.size());
+    for (const auto& sst : sstables) {
+        read_options.max_rss_rowid = sst->sstable_pb().max_rss_rowid();
+        iters.emplace_back(sst->new_iterator(read_options));
+    }
+    sstable::Options options;
+    std::unique_ptr<sstable::Iterator> iter(sstable::NewMergingIterator(options.comparator, &iters[0], iters.size()));
+    if (lower.empty()) {
+        iter->SeekToFirst();
+    } else {
+        iter->Seek(lower);
+    }
+    auto in_range = [&]() { return iter->Valid() && (upper.empty() || iter->key().compare(Slice(upper)) < 0); };
+    if (!in_range()) {
+        return iter->status();
+    }
+    KeyValueMerger merger(iter->key().to_string(), iter->max_rss_rowid(), output, base_level_merge);
+    while (in_range()) {
+        RETURN_IF_ERROR(merger.merge(iter->key().to_string(), iter->value().to_string(), iter->max_rss_rowid()));
+        iter->Next();
+    }
+    RETURN_IF_ERROR(iter->status());
+    merger.finish();
+    return Status::OK();
+}
+
+Status LakePersistentIndex::merge_sstables_in_parallel(
+        const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables,
+        const std::vector<std::string>& split_keys, ThreadPool* pool, sstable::TableBuilder* builder,
+        bool base_level_merge) {
+    struct MergeRangeTask {
+        MergeRangeTask() : latch(1) {}
+        Status status;
+        std::vector<std::pair<std::string, std::string>> output;
+        CountDownLatch latch;
+    };
+    // The merged outputs of ranges are buffered in memory until they are added to |builder|, charge them to the
+    // tracker of the compaction. They are allocated by the pool threads and freed by current thread.
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    const size_t nrange = split_keys.size() + 1;
+    const size_t max_inflight = std::max(1, pool->max_threads());
+    std::deque<std::shared_ptr<MergeRangeTask>> inflight;
+    // the tasks use |mem_tracker| and |sstables| of the caller, so they must finish before returning.
+    DeferOp wait_inflight([&]() {
+        for (auto& task : inflight) {
+            task->latch.wait();
+        }
+    });
+    size_t next_range = 0;
+    auto submit_next_range = [&]() {
+        auto task = std::make_shared<MergeRangeTask>();
+        std::string lower = next_range == 0 ? "" : split_keys[next_range - 1];
+        std::string upper = next_range + 1 == nrange ? "" : split_keys[next_range];
+        auto func = [=, &sstables]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            task->status = merge_key_range(sstables, lower, upper, base_level_merge, &task->output);
+            task->latch.count_down();
+        };
+        if (!pool->submit_func(func).ok()) {
+            // the pool is shutting down, merge the range in current thread.
+            func();
+        }
+        inflight.push_back(std::move(task));
+        next_range++;
+    };
+    auto submit_ranges = [&]() {
+        // one range is always in flight to make progress, the others wait while the memory limit is exceeded.
+        while (next_range < nrange && inflight.size() < max_inflight &&
+               (inflight.empty() || mem_tracker == nullptr || !mem_tracker->any_limit_exceeded())) {
+            submit_next_range();
+        }
+    };
+    submit_ranges();
+    while (!inflight.empty()) {
+        auto task = inflight.front();
+        task->latch.wait();
+        inflight.pop_front();
+        RETURN_IF_ERROR(task->status);
+        for (const auto& [key, value] : task->output) {
+            builder->Add(Slice(key), Slice(value));
+        }
+        task.reset();
+        TRACE_COUNTER_INCREMENT("pk_index_compaction_range_cnt", 1);
+        submit_ranges();
+    }
+    return builder->Finish();
+}
+
 Status LakePersistentIndex::major_compact(TabletManager* tablet_mgr, const TabletMetadata& metadata,
                                           TxnLogPB* txn_log) {
     if (metadata.sstable_meta().sstables_size() < config::lake_pk_index_sst_min_compaction_versions) {
@@ -477,7 +619,24 @@ Status LakePersistentIndex::major_compact(TabletManager* tablet_mgr, const Table
     filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
     options.filter_policy = filter_policy.get();
     sstable::TableBuilder builder(options, wf.get());
-    RETURN_IF_ERROR(merge_sstables(std::move(merging_iter_ptr), &builder, merge_base_level));
+    // Large compactions are split into key ranges which are merged concurrently, each range covers about
+    // `lake_pk_index_sst_compaction_range_bytes` of input data.
+    ThreadPool* pool = tablet_mgr->update_mgr() != nullptr ? tablet_mgr->update_mgr()->pk_index_compaction_pool()
+                                                             : nullptr;
+    std::vector<std::string> split_keys;
+    if (pool != nullptr && config::lake_pk_index_sst_compaction_range_bytes > 0) {
+        int64_t input_bytes = 0;
+        for (const auto& sst : sstable_vec) {
+            input_bytes += sst->sstable_pb().filesize();
+        }
+        split_keys = split_key_ranges(sstable_vec, input_bytes / config::lake_pk_index_sst_compaction_range_bytes);
+    }
+    if (split_keys.empty()) {
+        RETURN_IF_ERROR(merge_sstables(std::move(merging_iter_ptr), &builder, merge_base_level));
+    } else {
+        merging_iter_ptr.reset();
+        RETURN_IF_ERROR(merge_sstables_in_parallel(sstable_vec, split_keys, pool, &builder, merge_base_level));
+    }
     RETURN_IF_ERROR(wf->close());
 
     // record output sstable pb
@@ -508,7 +667,7 @@ Status LakePersistentIndex::apply_opcompaction(const TxnLogPB_OpCompaction& op_c
     if (block_cache == nullptr) {
         return Status::InternalError("Block cache is null.");
     }
-    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache()));
+    RETURN_IF_ERROR(sstable->init(std::move(rf), sstable_pb, block_cache->cache(), true, block_cache->prefetch_pool()));
 
     std::unordered_set<std::string> filenames;
     for (const auto& input_sstable : op_compaction.input_sstables()) {
@@ -19,6 +19,7 @@
 #include "storage/persistent_index.h"
 
 namespace starrocks {
+class ThreadPool;
 class TxnLogPB;
 class TxnLogPB_OpCompaction;
 
@@ -45,6 +46,16 @@ public:
               _builder(builder),
               _merge_base_level(merge_base_level) {}
 
+    // Merged key values are appended to |output| instead of a TableBuilder, used when a key range is merged
+    // in a separate thread.
+    explicit KeyValueMerger(const std::string& key, uint64_t max_rss_rowid,
+                            std::vector<std::pair<std::string, std::string>>* output, bool merge_base_level)
+            : _key(std::move(key)),
+              _max_rss_rowid(max_rss_rowid),
+              _builder(nullptr),
+              _output(output),
+              _merge_base_level(merge_base_level) {}
+
     Status merge(const std::string& key, const std::string& value, uint64_t max_rss_rowid);
 
     void finish() { flush(); }
@@ -56,6 +67,7 @@ private:
     std::string _key;
     uint64_t _max_rss_rowid = 0;
     sstable::TableBuilder* _builder;
+    std::vector<std::pair<std::string, std::string>>* _output = nullptr;
     std::list<IndexValueWithVer> _index_value_vers;
     // If do merge base level, that means we can delete NullIndexValue items safely.
     bool _merge_base_level = false;
@@ -186,6 +198,23 @@ private:
     static Status merge_sstables(std::unique_ptr<sstable::Iterator> iter_ptr, sstable::TableBuilder* builder,
                                  bool base_level_merge);
 
+    // Split the key space of |sstables| into at most |max_ranges| ranges of similar data size, by keys sampled
+    // from the index blocks of sstables. Returns split keys in ascending order, range i is [keys[i-1], keys[i]).
+    static std::vector<std::string> split_key_ranges(
+            const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables, size_t max_ranges);
+
+    // Merge the keys in [lower, upper) of |sstables| into |output|, empty bound means unbounded.
+    static Status merge_key_range(const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables,
+                                  const std::string& lower, const std::string& upper, bool base_level_merge,
+                                  std::vector<std::pair<std::string, std::string>>* output);
+
+    // Merge the key ranges split by |split_keys| concurrently in |pool|, and add the results to |builder| in
+    // key order. The merged outputs buffered in memory are charged to the mem tracker of current thread. At most
+    // `pool->max_threads()` ranges are in flight, and only one while the memory limit of the tracker is exceeded.
+    static Status merge_sstables_in_parallel(const std::vector<std::shared_ptr<PersistentIndexSstable>>& sstables,
+                                             const std::vector<std::string>& split_keys, ThreadPool* pool,
+                                             sstable::TableBuilder* builder, bool base_level_merge);
+
 private:
     std::unique_ptr<PersistentIndexMemtable> _memtable;
     TabletManager* _tablet_mgr{nullptr};
@@ -31,7 +31,7 @@
 
 namespace starrocks::lake {
 
-static std::string delvec_cache_key(int64_t tablet_id, const DelvecPagePB& page) {
+std::string delvec_cache_key(int64_t tablet_id, const DelvecPagePB& page) {
     DelvecCacheKeyPB cache_key_pb;
     cache_key_pb.set_id(tablet_id);
     cache_key_pb.mutable_delvec_page()->CopyFrom(page);
@@ -43,13 +43,8 @@ MetaFileBuilder::MetaFileBuilder(const Tablet& tablet, std::shared_ptr<TabletMet
 
 void MetaFileBuilder::append_delvec(const DelVectorPtr& delvec, uint32_t segment_id) {
     if (delvec->cardinality() > 0) {
-        const uint64_t offset = _buf.size();
-        std::string delvec_str;
-        delvec->save_to(&delvec_str);
-        _buf.insert(_buf.end(), delvec_str.begin(), delvec_str.end());
-        const uint64_t size = _buf.size() - offset;
-        _delvecs[segment_id].set_offset(offset);
-        _delvecs[segment_id].set_size(size);
+        // Serialization is deferred to finalize, so a segment whose delvec is rewritten by several txns of
+        // the same publish batch only keeps its latest version in the delvec file.
         _segmentid_to_delvec[segment_id] = delvec;
     }
 }
@@ -438,6 +433,16 @@ Status MetaFileBuilder::update_num_del_stat(const std::map<uint32_t, size_t>& se
 Status MetaFileBuilder::_finalize_delvec(int64_t version, int64_t txn_id) {
     if (!is_primary_key(_tablet_meta.get())) return Status::OK();
 
+    // 0. serialize the latest delvec of each segment into write buffer
+    for (const auto& [segment_id, delvec] : _segmentid_to_delvec) {
+        const uint64_t offset = _buf.size();
+        std::string delvec_str;
+        delvec->save_to(&delvec_str);
+        _buf.insert(_buf.end(), delvec_str.begin(), delvec_str.end());
+        _delvecs[segment_id].set_offset(offset);
+        _delvecs[segment_id].set_size(_buf.size() - offset);
+    }
+
     // 1. update delvec page in meta
     for (auto&& each_delvec : *(_tablet_meta->mutable_delvec_meta()->mutable_delvecs())) {
         auto iter = _delvecs.find(each_delvec.first);
@@ -538,13 +543,11 @@ Status MetaFileBuilder::finalize(int64_t txn_id) {
 }
 
 StatusOr<bool> MetaFileBuilder::find_delvec(const TabletSegmentId& tsid, DelVectorPtr* pdelvec) const {
-    auto iter = _delvecs.find(tsid.segment_id);
-    if (iter != _delvecs.end()) {
+    auto iter = _segmentid_to_delvec.find(tsid.segment_id);
+    if (iter != _segmentid_to_delvec.end()) {
+        // copy the pending delvec instead of deserializing it, callers are free to modify the returned one
         (*pdelvec) = std::make_shared<DelVector>();
-        // read delvec from write buf
-        RETURN_IF_ERROR((*pdelvec)->load(iter->second.version(),
-                                         reinterpret_cast<const char*>(_buf.data()) + iter->second.offset(),
-                                         iter->second.size()));
+        (*pdelvec)->copy_from(*iter->second);
         return true;
     }
     return false;
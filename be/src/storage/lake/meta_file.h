@@ -37,7 +37,7 @@ enum RecoverFlag { OK = 0, RECOVER_WITHOUT_PUBLISH, RECOVER_WITH_PUBLISH };
 class MetaFileBuilder {
 public:
     explicit MetaFileBuilder(const Tablet& tablet, std::shared_ptr<TabletMetadata> metadata_ptr);
-    // append delvec to builder's buffer
+    // append delvec to builder, the latest delvec of each segment is serialized to delvec file in finalize
     void append_delvec(const DelVectorPtr& delvec, uint32_t segment_id);
     // append delta column group to builder
     void append_dcg(uint32_t rssid, const std::vector<std::pair<std::string, std::string>>& file_with_encryption_metas,
@@ -86,7 +86,8 @@ private:
     UpdateManager* _update_mgr;
     Buffer<uint8_t> _buf;
     std::unordered_map<uint32_t, DelvecPagePB> _delvecs;
-    // from segment id to delvec, used for fill cache in finalize stage.
+    // from segment id to the latest delvec appended, serialized into `_buf` and used for fill cache in
+    // finalize stage.
     std::unordered_map<uint32_t, DelVectorPtr> _segmentid_to_delvec;
     // from cache key to segment id
     std::unordered_map<std::string, uint32_t> _cache_key_to_segment_id;
@@ -94,6 +95,8 @@ private:
     RecoverFlag _recover_flag = RecoverFlag::OK;
 };
 
+// The key of a delvec page of |tablet_id| in Metacache.
+std::string delvec_cache_key(int64_t tablet_id, const DelvecPagePB& page);
 Status get_del_vec(TabletManager* tablet_mgr, const TabletMetadata& metadata, uint32_t segment_id, bool fill_cache,
                    const LakeIOOptions& lake_io_opts, DelVector* delvec);
 bool is_primary_key(TabletMetadata* metadata);
@@ -0,0 +1,151 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/lake/metadata_prefetcher.h"
+
+#include <bvar/bvar.h>
+
+#include "common/config.h"
+#include "storage/del_vector.h"
+#include "storage/lake/meta_file.h"
+#include "storage/lake/metacache.h"
+#include "storage/lake/rowset.h"
+#include "storage/lake/tablet_manager.h"
+#include "util/stopwatch.hpp"
+#include "util/threadpool.h"
+
+namespace starrocks::lake {
+
+static bvar::Adder<uint64_t> g_metadata_prefetch_submitted("lake", "metadata_prefetch_submitted");
+// prefetch requests dropped because the tablet is being prefetched or too many tasks are pending
+static bvar::Adder<uint64_t> g_metadata_prefetch_skipped("lake", "metadata_prefetch_skipped");
+// the tablet metadata is found in metacache when the prefetch task runs
+static bvar::Adder<uint64_t> g_metadata_prefetch_hit("lake", "metadata_prefetch_hit");
+static bvar::Adder<uint64_t> g_metadata_prefetch_failed("lake", "metadata_prefetch_failed");
+static bvar::LatencyRecorder g_metadata_prefetch_latency("lake", "metadata_prefetch");
+
+MetadataPrefetcher::MetadataPrefetcher(TabletManager* tablet_mgr, int threads, int queue_size)
+        : _tablet_mgr(tablet_mgr) {
+    if (threads > 0) {
+        auto st = ThreadPoolBuilder("lake_meta_prefetch")
+                          .set_min_threads(0)
+                          .set_max_threads(threads)
+                          .set_max_queue_size(queue_size)
+                          .build(&_thread_pool);
+        CHECK(st.ok()) << st;
+    }
+}
+
+MetadataPrefetcher::~MetadataPrefetcher() {
+    stop();
+}
+
+void MetadataPrefetcher::stop() {
+    if (_thread_pool != nullptr) {
+        _thread_pool->shutdown();
+    }
+}
+
+void MetadataPrefetcher::prefetch(const std::vector<std::pair<int64_t, int64_t>>& tablet_versions) {
+    if (_thread_pool == nullptr) {
+        return;
+    }
+    for (const auto& [tablet_id, version] : tablet_versions) {
+        if (!_try_start(tablet_id)) {
+            g_metadata_prefetch_skipped << 1;
+            continue;
+        }
+        auto st = _thread_pool->submit_func([this, tablet_id = tablet_id, version = version]() {
+            auto st = _prefetch_tablet(tablet_id, version);
+            LOG_IF(WARNING, !st.ok()) << "Fail to prefetch metadata of tablet " << tablet_id << " version " << version
+                                      << ": " << st;
+            _finish(tablet_id);
+        });
+        if (!st.ok()) {
+            // the queue is full or the pool is shut down, leave the remaining tablets to be loaded on access.
+            g_metadata_prefetch_skipped << 1;
+            _finish(tablet_id);
+            break;
+        }
+        g_metadata_prefetch_submitted << 1;
+    }
+}
+
+Status MetadataPrefetcher::prefetch_tablet(int64_t tablet_id, int64_t version) {
+    if (!_try_start(tablet_id)) {
+        g_metadata_prefetch_skipped << 1;
+        return Status::OK();
+    }
+    auto st = _prefetch_tablet(tablet_id, version);
+    _finish(tablet_id);
+    return st;
+}
+
+Status MetadataPrefetcher::_prefetch_tablet(int64_t tablet_id, int64_t version) {
+    MonotonicStopWatch watch;
+    watch.start();
+    auto metadata_location = _tablet_mgr->tablet_metadata_location(tablet_id, version);
+    auto metadata = _tablet_mgr->metacache()->lookup_tablet_metadata(metadata_location);
+    if (metadata != nullptr) {
+        g_metadata_prefetch_hit << 1;
+    } else {
+        auto metadata_or = _tablet_mgr->get_tablet_metadata(metadata_location, true);
+        if (!metadata_or.ok()) {
+            g_metadata_prefetch_failed << 1;
+            return metadata_or.status();
+        }
+        metadata = std::move(metadata_or).value();
+    }
+
+    if (is_primary_key(*metadata)) {
+        LakeIOOptions lake_io_opts;
+        for (const auto& [segment_id, page] : metadata->delvec_meta().delvecs()) {
+            if (_tablet_mgr->metacache()->lookup_delvec(delvec_cache_key(tablet_id, page)) != nullptr) {
+                continue;
+            }
+            DelVector delvec;
+            auto st = get_del_vec(_tablet_mgr, *metadata, segment_id, true, lake_io_opts, &delvec);
+            if (!st.ok()) {
+                g_metadata_prefetch_failed << 1;
+                return st;
+            }
+        }
+    }
+
+    if (config::lake_metadata_prefetch_segment_footer) {
+        LakeIOOptions lake_io_opts{.fill_data_cache = false, .fill_metadata_cache = true};
+        for (int i = 0, sz = metadata->rowsets_size(); i < sz; i++) {
+            Rowset rowset(_tablet_mgr, metadata, i, 0);
+            auto segments_or = rowset.segments(lake_io_opts);
+            if (!segments_or.ok()) {
+                g_metadata_prefetch_failed << 1;
+                return segments_or.status();
+            }
+        }
+    }
+    g_metadata_prefetch_latency << watch.elapsed_time() / 1000;
+    return Status::OK();
+}
+
+bool MetadataPrefetcher::_try_start(int64_t tablet_id) {
+    std::lock_guard l(_mutex);
+    return _inflight.insert(tablet_id).second;
+}
+
+void MetadataPrefetcher::_finish(int64_t tablet_id) {
+    std::lock_guard l(_mutex);
+    _inflight.erase(tablet_id);
+}
+
+} // namespace starrocks::lake
@@ -0,0 +1,76 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "common/status.h"
+#include "gutil/macros.h"
+
+namespace starrocks {
+class ThreadPool;
+}
+
+namespace starrocks::lake {
+
+class TabletManager;
+
+// MetadataPrefetcher loads the tablet metadata, delete vectors and optionally segment footers of the tablets
+// that are about to be accessed into Metacache in background threads, so that the accessors which
+// populate Metacache lazily do not pay one serial object storage request per tablet.
+//
+// Prefetching is best-effort: tablets that are already being prefetched are skipped, and tablets that can not
+// be queued because the number of pending tasks has reached the limit are loaded lazily on access as before.
+class MetadataPrefetcher {
+public:
+    // |threads| is the max number of concurrent prefetch tasks and |queue_size| is the max number of
+    // pending prefetch tasks, prefetching is disabled if |threads| <= 0.
+    MetadataPrefetcher(TabletManager* tablet_mgr, int threads, int queue_size);
+
+    ~MetadataPrefetcher();
+
+    DISALLOW_COPY_AND_MOVE(MetadataPrefetcher);
+
+    // Submit prefetch tasks for the given (tablet id, version) pairs and return immediately.
+    void prefetch(const std::vector<std::pair<int64_t, int64_t>>& tablet_versions);
+
+    // Prefetch a single tablet synchronously in the calling thread, returns OK without prefetching it if the
+    // tablet is being prefetched.
+    Status prefetch_tablet(int64_t tablet_id, int64_t version);
+
+    void stop();
+
+private:
+    Status _prefetch_tablet(int64_t tablet_id, int64_t version);
+
+    // Returns false if |tablet_id| is being prefetched, otherwise marks it as being prefetched.
+    bool _try_start(int64_t tablet_id);
+
+    void _finish(int64_t tablet_id);
+
+    TabletManager* _tablet_mgr;
+    std::unique_ptr<ThreadPool> _thread_pool;
+
+    std::mutex _mutex;
+    // tablets that are queued or being prefetched, at any version, since the versions of a tablet share most of
+    // their delvecs and segments
+    std::unordered_set<int64_t> _inflight;
+};
+
+} // namespace starrocks::lake
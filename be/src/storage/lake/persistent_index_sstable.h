@@ -25,6 +25,7 @@
 
 namespace starrocks {
 
+class ThreadPool;
 class WritableFile;
 class PersistentIndexSstablePB;
 
@@ -39,8 +40,9 @@ public:
     PersistentIndexSstable() = default;
     ~PersistentIndexSstable() = default;
 
+    // |prefetch_pool| : if not null, blocks missed in |cache| needed by one multi_get are read concurrently in it.
     Status init(std::unique_ptr<RandomAccessFile> rf, const PersistentIndexSstablePB& sstable_pb, Cache* cache,
-                bool need_filter = true);
+                bool need_filter = true, ThreadPool* prefetch_pool = nullptr);
 
     static Status build_sstable(const phmap::btree_map<std::string, IndexValueWithVer, std::less<>>& map,
                                 WritableFile* wf, uint64_t* filesz);
@@ -56,6 +58,8 @@ public:
 
     sstable::Iterator* new_iterator(const sstable::ReadOptions& options) { return _sst->NewIterator(options); }
 
+    sstable::Iterator* new_index_iterator() { return _sst->NewIndexIterator(); }
+
     const PersistentIndexSstablePB& sstable_pb() const { return _sstable_pb; }
 
     size_t memory_usage() const;
@@ -65,6 +69,7 @@ private:
     std::unique_ptr<sstable::FilterPolicy> _filter_policy{nullptr};
     std::unique_ptr<RandomAccessFile> _rf{nullptr};
     PersistentIndexSstablePB _sstable_pb;
+    ThreadPool* _prefetch_pool{nullptr};
 };
 
 } // namespace lake
@@ -91,6 +91,7 @@ Status HorizontalPkTabletWriter::flush_segment_writer(SegmentPB* segment) {
         partial_rowset_footer->set_size(segment_size - footer_position);
         const std::string& segment_path = _seg_writer->segment_path();
         std::string segment_name = std::string(basename(segment_path));
+        add_segment_footer(segment_name, *_seg_writer);
         _files.emplace_back(FileInfo{segment_name, segment_size, _seg_writer->encryption_meta()});
         _data_size += segment_size;
         _stats.bytes_write += segment_size;
@@ -19,7 +19,10 @@
 #include "storage/chunk_helper.h"
 #include "storage/delete_predicates.h"
 #include "storage/lake/column_mode_partial_update_handler.h"
+#include "storage/lake/filenames.h"
 #include "storage/lake/lake_delvec_loader.h"
+#include "storage/lake/metacache.h"
+#include "storage/lake/segment_meta_bundle.h"
 #include "storage/lake/tablet.h"
 #include "storage/lake/tablet_writer.h"
 #include "storage/lake/update_manager.h"
@@ -402,6 +405,43 @@ Status Rowset::load_segments(std::vector<SegmentPtr>* segments, bool fill_cache,
     return load_segments(segments, seg_options, nullptr);
 }
 
+// Read the footers of all segments of |rowset| from its segment meta bundle. Returns an empty vector if the
+// segments have been cached, or the bundle does not exist or does not cover all segments.
+static std::vector<SegmentFooterPB> read_footers_from_meta_bundle(TabletManager* tablet_mgr, int64_t tablet_id,
+                                                                  const RowsetMetadataPB& rowset,
+                                                                  const SegmentReadOptions& seg_options) {
+    const auto& lake_io_opts = seg_options.lake_io_opts;
+    auto location = [&](std::string_view name) {
+        return lake_io_opts.location_provider ? lake_io_opts.location_provider->segment_location(tablet_id, name)
+                                              : tablet_mgr->segment_location(tablet_id, name);
+    };
+    if (tablet_mgr->metacache()->lookup_segment(location(rowset.segments(0))) != nullptr) {
+        return {};
+    }
+    auto bundle_path = location(segment_meta_bundle_filename(rowset.segments(0)));
+    std::shared_ptr<FileSystem> fs = seg_options.fs;
+    if (fs == nullptr) {
+        auto fs_or = FileSystem::CreateSharedFromString(bundle_path);
+        if (!fs_or.ok()) {
+            return {};
+        }
+        fs = std::move(fs_or).value();
+    }
+    auto bundle_or = SegmentMetaBundle::read(fs.get(), bundle_path);
+    if (!bundle_or.ok()) {
+        LOG_IF(WARNING, !bundle_or.status().is_not_found())
+                << "Fail to read segment meta bundle: " << bundle_or.status();
+        return {};
+    }
+    std::vector<SegmentFooterPB> footers(rowset.segments_size());
+    for (int i = 0, sz = rowset.segments_size(); i < sz; i++) {
+        if (!bundle_or.value()->get_footer(rowset.segments(i), &footers[i]).ok()) {
+            return {};
+        }
+    }
+    return footers;
+}
+
 Status Rowset::load_segments(std::vector<SegmentPtr>* segments, SegmentReadOptions& seg_options,
                              std::pair<std::vector<SegmentPtr>, std::vector<SegmentPtr>>* not_used_segments) {
 #if !defined BE_TEST && !defined(BUILD_FORMAT_LIB)
@@ -425,6 +465,14 @@ Status Rowset::load_segments(std::vector<SegmentPtr>* segments, SegmentReadOptio
     const auto& files_to_size = metadata().segment_size();
     int index = 0;
 
+    // Open all segments with the footers in the segment meta bundle of the rowset if there is one, which costs
+    // one read request instead of one per segment.
+    std::vector<SegmentFooterPB> bundle_footers;
+    if (config::lake_enable_segment_meta_bundle && segment_file_size > 1 &&
+        metadata().segment_encryption_metas_size() == 0) {
+        bundle_footers = read_footers_from_meta_bundle(_tablet_mgr, tablet_id(), metadata(), seg_options);
+    }
+
     std::vector<std::future<std::pair<StatusOr<SegmentPtr>, std::string>>> segment_futures;
     auto check_status = [&](StatusOr<SegmentPtr>& segment_or, const std::string& seg_name, int seg_id) -> Status {
         if (segment_or.ok()) {
@@ -462,7 +510,15 @@ Status Rowset::load_segments(std::vector<SegmentPtr>* segments, SegmentReadOptio
         }
         index++;
 
-        if (_parallel_load) {
+        if (!bundle_footers.empty()) {
+            auto segment_or = _tablet_mgr->load_segment(segment_info, seg_id, &footer_size_hint, lake_io_opts,
+                                                        lake_io_opts.fill_metadata_cache, _tablet_schema,
+                                                        &bundle_footers[index - 1]);
+            if (auto status = check_status(segment_or, seg_name, seg_id); !status.ok()) {
+                return status;
+            }
+            seg_id++;
+        } else if (_parallel_load) {
             auto task = std::make_shared<std::packaged_task<std::pair<StatusOr<SegmentPtr>, std::string>()>>([=]() {
                 auto result = _tablet_mgr->load_segment(segment_info, seg_id, lake_io_opts,
                                                         lake_io_opts.fill_metadata_cache, _tablet_schema);
@@ -0,0 +1,128 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/lake/segment_meta_bundle.h"
+
+#include <bvar/bvar.h>
+#include <fmt/format.h>
+
+#include <cstring>
+
+#include "fs/fs.h"
+#include "gen_cpp/segment.pb.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
+
+namespace starrocks::lake {
+
+static const char* const kSegmentMetaBundleMagic = "SMB1";
+static const uint32_t kSegmentMetaBundleMagicLength = 4;
+// IndexSize(4) Checksum(4) Magic(4)
+static const uint32_t kSegmentMetaBundleTrailerLength = 12;
+
+static bvar::Adder<uint64_t> g_segment_meta_bundle_read("lake", "segment_meta_bundle_read");
+static bvar::Adder<uint64_t> g_segment_meta_bundle_segments("lake", "segment_meta_bundle_segments");
+
+void SegmentMetaBundleBuilder::add(std::string segment_name, const SegmentFooterPB& footer) {
+    uint64_t offset = _buf.size();
+    footer.AppendToString(&_buf);
+    _entries.emplace_back(std::move(segment_name), offset, static_cast<uint32_t>(_buf.size() - offset));
+}
+
+Status SegmentMetaBundleBuilder::finish(WritableFile* file) {
+    std::string index;
+    put_varint32(&index, _entries.size());
+    for (const auto& [name, offset, size] : _entries) {
+        put_length_prefixed_slice(&index, Slice(name));
+        put_varint64(&index, offset);
+        put_varint32(&index, size);
+    }
+    uint32_t checksum = crc32c::Value(_buf.data(), _buf.size());
+    checksum = crc32c::Extend(checksum, index.data(), index.size());
+
+    std::string trailer;
+    put_fixed32_le(&trailer, index.size());
+    put_fixed32_le(&trailer, checksum);
+    trailer.append(kSegmentMetaBundleMagic, kSegmentMetaBundleMagicLength);
+
+    std::vector<Slice> slices{Slice(_buf), Slice(index), Slice(trailer)};
+    RETURN_IF_ERROR(file->appendv(slices.data(), slices.size()));
+    return file->close();
+}
+
+StatusOr<std::unique_ptr<SegmentMetaBundle>> SegmentMetaBundle::read(FileSystem* fs, const std::string& path) {
+    RandomAccessFileOptions opts{.skip_fill_local_cache = true};
+    ASSIGN_OR_RETURN(auto file, fs->new_random_access_file(opts, path));
+    ASSIGN_OR_RETURN(auto data, file->read_all());
+    g_segment_meta_bundle_read << 1;
+    auto bundle_or = parse(std::move(data));
+    if (!bundle_or.ok()) {
+        return bundle_or.status().clone_and_append(path);
+    }
+    g_segment_meta_bundle_segments << bundle_or.value()->num_segments();
+    return bundle_or;
+}
+
+StatusOr<std::unique_ptr<SegmentMetaBundle>> SegmentMetaBundle::parse(std::string data) {
+    if (data.size() < kSegmentMetaBundleTrailerLength) {
+        return Status::Corruption(fmt::format("segment meta bundle too small: {}", data.size()));
+    }
+    const auto* trailer = reinterpret_cast<const uint8_t*>(data.data() + data.size() - kSegmentMetaBundleTrailerLength);
+    if (memcmp(trailer + 8, kSegmentMetaBundleMagic, kSegmentMetaBundleMagicLength) != 0) {
+        return Status::Corruption("bad segment meta bundle magic number");
+    }
+    const uint32_t index_size = decode_fixed32_le(trailer);
+    const uint32_t checksum = decode_fixed32_le(trailer + 4);
+    const size_t body_size = data.size() - kSegmentMetaBundleTrailerLength;
+    if (index_size > body_size) {
+        return Status::Corruption(fmt::format("bad segment meta bundle index size: {}", index_size));
+    }
+    if (crc32c::Value(data.data(), body_size) != checksum) {
+        return Status::Corruption("segment meta bundle checksum mismatch");
+    }
+
+    auto bundle = std::make_unique<SegmentMetaBundle>();
+    const uint64_t footers_size = body_size - index_size;
+    Slice index(data.data() + footers_size, index_size);
+    uint32_t count = 0;
+    if (!get_varint32(&index, &count)) {
+        return Status::Corruption("bad segment meta bundle index");
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        Slice name;
+        uint64_t offset = 0;
+        uint32_t size = 0;
+        if (!get_length_prefixed_slice(&index, &name) || !get_varint64(&index, &offset) ||
+            !get_varint32(&index, &size) || offset + size > footers_size) {
+            return Status::Corruption("bad segment meta bundle index entry");
+        }
+        bundle->_footers.emplace(name.to_string(), std::make_pair(offset, size));
+    }
+    bundle->_data = std::move(data);
+    return bundle;
+}
+
+Status SegmentMetaBundle::get_footer(std::string_view segment_name, SegmentFooterPB* footer) const {
+    auto iter = _footers.find(std::string(segment_name));
+    if (iter == _footers.end()) {
+        return Status::NotFound(fmt::format("no footer of segment {} in meta bundle", segment_name));
+    }
+    const auto& [offset, size] = iter->second;
+    if (!footer->ParseFromArray(_data.data() + offset, static_cast<int>(size))) {
+        return Status::Corruption(fmt::format("failed to parse footer of segment {} in meta bundle", segment_name));
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks::lake
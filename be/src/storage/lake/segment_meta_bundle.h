@@ -0,0 +1,78 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "common/statusor.h"
+
+namespace starrocks {
+class FileSystem;
+class SegmentFooterPB;
+class WritableFile;
+} // namespace starrocks
+
+namespace starrocks::lake {
+
+// A segment meta bundle keeps the footers of all segments of a rowset in one object, so that the segments
+// of the rowset can be opened with a single read request instead of one footer read per segment.
+// The bundle of a rowset is named after its first segment, see `segment_meta_bundle_filename`.
+//
+// File format:
+//   Bundle  := Footer[0] ... Footer[n-1] Index IndexSize(4) Checksum(4) Magic(4)
+//   Index   := Count(varint32) Entry[0] ... Entry[n-1]
+//   Entry   := SegmentName(length prefixed) Offset(varint64) Size(varint32)
+// `Checksum` is the crc32c of all bytes before `IndexSize`.
+class SegmentMetaBundleBuilder {
+public:
+    // Add the footer of a finished segment, the footer is serialized immediately.
+    void add(std::string segment_name, const SegmentFooterPB& footer);
+
+    size_t num_segments() const { return _entries.size(); }
+
+    // Serialize all added footers and write them to |file|, |file| is closed on success.
+    Status finish(WritableFile* file);
+
+private:
+    std::string _buf;
+    // segment name, offset and size of the footer in `_buf`
+    std::vector<std::tuple<std::string, uint64_t, uint32_t>> _entries;
+};
+
+class SegmentMetaBundle {
+public:
+    // Read the bundle at |path| with one read request.
+    static StatusOr<std::unique_ptr<SegmentMetaBundle>> read(FileSystem* fs, const std::string& path);
+
+    static StatusOr<std::unique_ptr<SegmentMetaBundle>> parse(std::string data);
+
+    size_t num_segments() const { return _footers.size(); }
+
+    // Return NotFound if the bundle does not contain the footer of |segment_name|.
+    Status get_footer(std::string_view segment_name, SegmentFooterPB* footer) const;
+
+private:
+    std::string _data;
+    // segment name to (offset, size) of the footer in `_data`
+    std::unordered_map<std::string, std::pair<uint64_t, uint32_t>> _footers;
+};
+
+} // namespace starrocks::lake
@@ -36,6 +36,7 @@
 #include "storage/lake/location_provider.h"
 #include "storage/lake/meta_file.h"
 #include "storage/lake/metacache.h"
+#include "storage/lake/metadata_prefetcher.h"
 #include "storage/lake/tablet.h"
 #include "storage/lake/tablet_metadata.h"
 #include "storage/lake/txn_log.h"
@@ -68,13 +69,18 @@ TabletManager::TabletManager(std::shared_ptr<LocationProvider> location_provider
                              int64_t cache_capacity)
         : _location_provider(std::move(location_provider)),
           _metacache(std::make_unique<Metacache>(cache_capacity)),
+          _metadata_prefetcher(std::make_unique<MetadataPrefetcher>(this, config::lake_metadata_prefetch_threads,
+                                                                    config::lake_metadata_prefetch_queue_size)),
           _compaction_scheduler(std::make_unique<CompactionScheduler>(this)),
           _update_mgr(update_mgr) {
     _update_mgr->set_tablet_mgr(this);
 }
 
 TabletManager::TabletManager(std::shared_ptr<LocationProvider> location_provider, int64_t cache_capacity)
-        : _location_provider(std::move(location_provider)), _metacache(std::make_unique<Metacache>(cache_capacity)) {}
+        : _location_provider(std::move(location_provider)),
+          _metacache(std::make_unique<Metacache>(cache_capacity)),
+          _metadata_prefetcher(std::make_unique<MetadataPrefetcher>(this, config::lake_metadata_prefetch_threads,
+                                                                    config::lake_metadata_prefetch_queue_size)) {}
 
 TabletManager::~TabletManager() = default;
 
@@ -1055,7 +1061,7 @@ StatusOr<VersionedTablet> TabletManager::get_tablet(int64_t tablet_id, int64_t v
 
 StatusOr<SegmentPtr> TabletManager::load_segment(const FileInfo& segment_info, int segment_id, size_t* footer_size_hint,
                                                  const LakeIOOptions& lake_io_opts, bool fill_metadata_cache,
-                                                 TabletSchemaPtr tablet_schema) {
+                                                 TabletSchemaPtr tablet_schema, SegmentFooterPB* footer) {
     // NOTE: if partial compaction is turned on, `segment_id` might not be the same as cached segment id
     //       for example, in tablet X, segment `a` has segment id 10, if partial compaction happens,
     //                    in tablet X+1, segment `a` might still exists, but its actual id will not be 10.
@@ -1081,7 +1087,11 @@ StatusOr<SegmentPtr> TabletManager::load_segment(const FileInfo& segment_info, i
     // segment->open will read the footer, and it is time-consuming.
     // separate it from static Segment::open is to prevent a large number of cache misses,
     // and many temporary segment objects generation when loading the same segment concurrently.
-    RETURN_IF_ERROR(segment->open(footer_size_hint, nullptr, lake_io_opts));
+    if (footer != nullptr) {
+        RETURN_IF_ERROR(segment->open_with_footer(footer));
+    } else {
+        RETURN_IF_ERROR(segment->open(footer_size_hint, nullptr, lake_io_opts));
+    }
     return segment;
 }
 
@@ -1094,6 +1104,7 @@ StatusOr<SegmentPtr> TabletManager::load_segment(const FileInfo& segment_info, i
 }
 
 void TabletManager::stop() {
+    _metadata_prefetcher->stop();
     _compaction_scheduler->stop();
 }
 
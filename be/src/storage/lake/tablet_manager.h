@@ -33,6 +33,7 @@
 namespace starrocks {
 struct FileInfo;
 class Segment;
+class SegmentFooterPB;
 class TabletSchemaPB;
 class TCreateTabletReq;
 } // namespace starrocks
@@ -48,6 +49,7 @@ using TabletAndRowsets = std::tuple<std::shared_ptr<Tablet>, std::vector<BaseRow
 
 class CompactionScheduler;
 class Metacache;
+class MetadataPrefetcher;
 class VersionedTablet;
 
 class TabletManager {
@@ -189,6 +191,8 @@ public:
     // The return value will never be null.
     Metacache* metacache() { return _metacache.get(); }
 
+    MetadataPrefetcher* metadata_prefetcher() { return _metadata_prefetcher.get(); }
+
     StatusOr<int64_t> get_tablet_data_size(int64_t tablet_id, int64_t* version_hint);
 
     StatusOr<int64_t> get_tablet_num_rows(int64_t tablet_id, int64_t version);
@@ -208,9 +212,11 @@ public:
     // updating the cache size where the cached object is not the one as expected.
     void update_segment_cache_size(std::string_view key, intptr_t segment_addr_hint = 0);
 
+    // |footer| is the footer of the segment if it has been read already, e.g. from the segment meta bundle
+    // of the rowset, the segment file is not accessed to open the segment in this case.
     StatusOr<SegmentPtr> load_segment(const FileInfo& segment_info, int segment_id, size_t* footer_size_hint,
                                       const LakeIOOptions& lake_io_opts, bool fill_metadata_cache,
-                                      TabletSchemaPtr tablet_schema);
+                                      TabletSchemaPtr tablet_schema, SegmentFooterPB* footer = nullptr);
     // for load segment parallel
     StatusOr<SegmentPtr> load_segment(const FileInfo& segment_info, int segment_id, const LakeIOOptions& lake_io_opts,
                                       bool fill_metadata_cache, TabletSchemaPtr tablet_schema);
@@ -242,6 +248,7 @@ private:
 private:
     std::shared_ptr<LocationProvider> _location_provider;
     std::unique_ptr<Metacache> _metacache;
+    std::unique_ptr<MetadataPrefetcher> _metadata_prefetcher;
     std::unique_ptr<CompactionScheduler> _compaction_scheduler;
     UpdateManager* _update_mgr = nullptr;
 
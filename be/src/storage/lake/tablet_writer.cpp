@@ -0,0 +1,58 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/lake/tablet_writer.h"
+
+#include "common/config.h"
+#include "fs/fs_util.h"
+#include "storage/lake/filenames.h"
+#include "storage/lake/tablet_manager.h"
+#include "storage/rowset/segment_writer.h"
+
+namespace starrocks::lake {
+
+void TabletWriter::add_segment_footer(std::string segment_name, const SegmentWriter& segment_writer) {
+    if (config::lake_enable_segment_meta_bundle && segment_writer.encryption_meta().empty()) {
+        _meta_bundle_builder.add(std::move(segment_name), segment_writer.footer());
+    }
+}
+
+void TabletWriter::write_segment_meta_bundle() {
+    std::string first_segment;
+    size_t num_segments = 0;
+    for (const auto& f : _files) {
+        if (is_segment(f.path) && num_segments++ == 0) {
+            first_segment = f.path;
+        }
+    }
+    // readers only use the bundle when it covers all segments of the rowset
+    if (num_segments < 2 || _meta_bundle_builder.num_segments() != num_segments) {
+        return;
+    }
+    auto name = segment_meta_bundle_filename(first_segment);
+    auto st = [&]() -> Status {
+        std::unique_ptr<WritableFile> of;
+        if (_location_provider && _fs) {
+            ASSIGN_OR_RETURN(of, _fs->new_writable_file(_location_provider->segment_location(_tablet_id, name)));
+        } else {
+            ASSIGN_OR_RETURN(of, fs::new_writable_file(_tablet_mgr->segment_location(_tablet_id, name)));
+        }
+        return _meta_bundle_builder.finish(of.get());
+    }();
+    // the segment meta bundle is optional, readers fall back to read footers from segment files
+    LOG_IF(WARNING, !st.ok()) << "Fail to write segment meta bundle " << name << " of tablet " << _tablet_id << ": "
+                              << st;
+}
+
+} // namespace starrocks::lake
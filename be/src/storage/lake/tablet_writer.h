@@ -22,11 +22,13 @@
 #include "gen_cpp/data.pb.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "storage/lake/location_provider.h"
+#include "storage/lake/segment_meta_bundle.h"
 #include "storage/tablet_schema.h"
 
 namespace starrocks {
 class Chunk;
 class Column;
+class SegmentWriter;
 class TabletSchema;
 class ThreadPool;
 
@@ -141,6 +143,14 @@ public:
     const OlapWriterStatistics& stats() const { return _stats; }
 
 protected:
+    // Record the footer of a finished segment for the segment meta bundle.
+    void add_segment_footer(std::string segment_name, const SegmentWriter& segment_writer);
+
+    // Write the footers of all segments written by this writer into the segment meta bundle of the rowset.
+    // The bundle is rewritten if the writer is finished more than once. Failures are only logged, since
+    // readers fall back to read footers from segment files.
+    void write_segment_meta_bundle();
+
     TabletManager* _tablet_mgr;
     int64_t _tablet_id;
     TabletSchemaCSPtr _schema;
@@ -157,6 +167,7 @@ protected:
     OlapWriterStatistics _stats;
 
     bool _is_compaction = false;
+    SegmentMetaBundleBuilder _meta_bundle_builder;
 };
 
 } // namespace lake
@@ -14,10 +14,12 @@
 
 #include "storage/lake/transactions.h"
 
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "gutil/strings/join.h"
 #include "runtime/exec_env.h"
+#include "storage/lake/filenames.h"
 #include "storage/lake/metacache.h"
 #include "storage/lake/replication_txn_manager.h"
 #include "storage/lake/tablet.h"
@@ -26,6 +28,7 @@
 #include "storage/lake/txn_log_applier.h"
 #include "storage/lake/update_manager.h"
 #include "storage/lake/vacuum.h" // delete_files_async
+#include "util/countdown_latch.h"
 #include "util/lru_cache.h"
 
 namespace {
@@ -139,6 +142,33 @@ StatusOr<TxnLogPtr> load_txn_log(TabletManager* tablet_mgr, int64_t tablet_id, c
     }
 }
 
+// Load txn logs of a publish batch concurrently, since reading them from remote storage one by one dominates the
+// latency of publishing many transactions at once. The i-th result is the txn log of txns[i].
+std::vector<StatusOr<TxnLogPtr>> load_txn_logs(TabletManager* tablet_mgr, int64_t tablet_id,
+                                               std::span<const TxnInfoPB> txns) {
+    std::vector<StatusOr<TxnLogPtr>> txn_logs(txns.size());
+    auto thread_pool = ExecEnv::GetInstance()->load_txn_log_thread_pool();
+    if (txns.size() <= 1 || thread_pool == nullptr) {
+        for (size_t i = 0; i < txns.size(); i++) {
+            txn_logs[i] = load_txn_log(tablet_mgr, tablet_id, txns[i]);
+        }
+        return txn_logs;
+    }
+    CountDownLatch latch(static_cast<int>(txns.size()));
+    for (size_t i = 0; i < txns.size(); i++) {
+        auto st = thread_pool->submit_func([&, i]() {
+            txn_logs[i] = load_txn_log(tablet_mgr, tablet_id, txns[i]);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            txn_logs[i] = load_txn_log(tablet_mgr, tablet_id, txns[i]);
+            latch.count_down();
+        }
+    }
+    latch.wait();
+    return txn_logs;
+}
+
 } // namespace
 
 StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t tablet_id, int64_t base_version,
@@ -247,9 +277,10 @@ StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t t
     // 5. txn4 will be published in later publish task, but we can't judge what's the latest_version in BE and we can not reapply txn_log if
     // txn logs have been deleted.
     int txn_offset = base_version - ori_base_version;
+    auto txn_logs = load_txn_logs(tablet_mgr, tablet_id, txns.subspan(txn_offset));
     for (size_t i = txn_offset, sz = txns.size(); i < sz; i++) {
         bool ignore_txn_log = false;
-        auto txn_log_st = load_txn_log(tablet_mgr, tablet_id, txns[i]);
+        auto txn_log_st = std::move(txn_logs[i - txn_offset]);
 
         if (txn_log_st.status().is_not_found()) {
             if (i == 0) {
@@ -454,10 +485,20 @@ Status publish_log_version(TabletManager* tablet_mgr, int64_t tablet_id, std::sp
 
 void collect_files_in_log(TabletManager* tablet_mgr, const TxnLog& txn_log, std::vector<std::string>* files_to_delete) {
     auto tablet_id = txn_log.tablet_id();
+    auto collect_segment_meta_bundle = [&](const RowsetMetadataPB& rowset, int segment_offset) {
+        if (!config::lake_enable_segment_meta_bundle) {
+            return;
+        }
+        auto bundle = rowset_segment_meta_bundle_filename(rowset.segments(), segment_offset);
+        if (!bundle.empty()) {
+            files_to_delete->emplace_back(tablet_mgr->segment_location(tablet_id, bundle));
+        }
+    };
     if (txn_log.has_op_write()) {
         for (const auto& segment : txn_log.op_write().rowset().segments()) {
             files_to_delete->emplace_back(tablet_mgr->segment_location(tablet_id, segment));
         }
+        collect_segment_meta_bundle(txn_log.op_write().rowset(), 0);
         for (const auto& del_file : txn_log.op_write().dels()) {
             files_to_delete->emplace_back(tablet_mgr->del_location(tablet_id, del_file));
         }
@@ -470,12 +511,14 @@ void collect_files_in_log(TabletManager* tablet_mgr, const TxnLog& txn_log, std:
         for (size_t idx = new_segment_offset, cnt = 0; idx < segments.size() && cnt < new_segment_count; ++idx, ++cnt) {
             files_to_delete->emplace_back(tablet_mgr->segment_location(tablet_id, segments[idx]));
         }
+        collect_segment_meta_bundle(txn_log.op_compaction().output_rowset(), new_segment_offset);
     }
     if (txn_log.has_op_schema_change() && !txn_log.op_schema_change().linked_segment()) {
         for (const auto& rowset : txn_log.op_schema_change().rowsets()) {
             for (const auto& segment : rowset.segments()) {
                 files_to_delete->emplace_back(tablet_mgr->segment_location(tablet_id, segment));
             }
+            collect_segment_meta_bundle(rowset, 0);
         }
     }
     if (txn_log.has_op_replication()) {
@@ -483,6 +526,7 @@ void collect_files_in_log(TabletManager* tablet_mgr, const TxnLog& txn_log, std:
             for (const auto& segment : op_write.rowset().segments()) {
                 files_to_delete->emplace_back(tablet_mgr->segment_location(tablet_id, segment));
             }
+            collect_segment_meta_bundle(op_write.rowset(), 0);
             for (const auto& del_file : op_write.dels()) {
                 files_to_delete->emplace_back(tablet_mgr->del_location(tablet_id, del_file));
             }
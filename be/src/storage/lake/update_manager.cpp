@@ -61,6 +61,13 @@ UpdateManager::UpdateManager(std::shared_ptr<LocationProvider> location_provider
     const int64_t block_cache_mem_limit =
             update_mem_limit * std::max(std::min(100, config::lake_pk_index_block_cache_limit_percent), 0) / 100;
     _block_cache = std::make_unique<PersistentIndexBlockCache>(mem_tracker, block_cache_mem_limit);
+    if (config::lake_pk_index_sst_compaction_threads > 0) {
+        auto st = ThreadPoolBuilder("pk_index_sst_compaction")
+                          .set_min_threads(0)
+                          .set_max_threads(config::lake_pk_index_sst_compaction_threads)
+                          .build(&_pk_index_compaction_pool);
+        CHECK(st.ok()) << st;
+    }
 }
 
 UpdateManager::~UpdateManager() {
@@ -76,6 +83,13 @@ inline std::string cache_key(uint32_t tablet_id, int64_t txn_id) {
 PersistentIndexBlockCache::PersistentIndexBlockCache(MemTracker* mem_tracker, int64_t cache_limit)
         : _cache(new_lru_cache(cache_limit)) {
     _mem_tracker = std::make_unique<MemTracker>(cache_limit, "lake_persistent_index_block_cache", mem_tracker);
+    if (config::lake_pk_index_sst_prefetch_threads > 0) {
+        auto st = ThreadPoolBuilder("pk_index_sst_prefetch")
+                          .set_min_threads(0)
+                          .set_max_threads(config::lake_pk_index_sst_prefetch_threads)
+                          .build(&_prefetch_pool);
+        CHECK(st.ok()) << st;
+    }
 }
 
 void PersistentIndexBlockCache::update_memory_usage() {
@@ -50,11 +50,15 @@ public:
 
     Cache* cache() { return _cache.get(); }
 
+    // Pool used to read blocks missed in cache concurrently, nullptr if disabled.
+    ThreadPool* prefetch_pool() { return _prefetch_pool.get(); }
+
 private:
     std::mutex _mutex;
     size_t _memory_usage{0};
     std::unique_ptr<Cache> _cache;
     std::unique_ptr<MemTracker> _mem_tracker;
+    std::unique_ptr<ThreadPool> _prefetch_pool;
 };
 
 // This is a converter between rowset segment id and segment file info. We need this converter
@@ -202,6 +206,9 @@ public:
 
     PersistentIndexBlockCache* block_cache() { return _block_cache.get(); }
 
+    // Pool used to merge key ranges of pk index major compaction concurrently, nullptr if disabled.
+    ThreadPool* pk_index_compaction_pool() { return _pk_index_compaction_pool.get(); }
+
     Status pk_index_major_compaction(int64_t tablet_id, DataDir* data_dir);
 
     bool TEST_primary_index_refcnt(int64_t tablet_id, uint32_t expected_cnt);
@@ -258,6 +265,7 @@ private:
     std::vector<PkIndexShard> _pk_index_shards;
 
     std::unique_ptr<PersistentIndexBlockCache> _block_cache;
+    std::unique_ptr<ThreadPool> _pk_index_compaction_pool;
 };
 
 } // namespace lake
@@ -17,6 +17,8 @@
 #include <butil/time.h>
 #include <bvar/bvar.h>
 
+#include <atomic>
+#include <mutex>
 #include <set>
 #include <string_view>
 #include <unordered_map>
@@ -26,6 +28,7 @@
 #include "fs/fs.h"
 #include "gutil/stl_util.h"
 #include "gutil/strings/util.h"
+#include "runtime/exec_env.h"
 #include "storage/lake/filenames.h"
 #include "storage/lake/join_path.h"
 #include "storage/lake/location_provider.h"
@@ -36,8 +39,10 @@
 #include "storage/lake/update_manager.h"
 #include "storage/protobuf_file.h"
 #include "testutil/sync_point.h"
+#include "util/countdown_latch.h"
 #include "util/defer_op.h"
 #include "util/raw_container.h"
+#include "util/threadpool.h"
 
 namespace starrocks::lake {
 
@@ -280,12 +285,27 @@ void run_clear_task_async(std::function<void()> task) {
     LOG_IF(ERROR, !st.ok()) << st;
 }
 
+// The segment meta bundle of a rowset is deleted together with its segments. The bundles written before the config
+// is turned off are left to the orphan data file GC.
+static Status delete_segment_meta_bundle(const RowsetMetadataPB& rowset, const std::string& base_dir,
+                                         AsyncFileDeleter* deleter, int segment_offset = 0) {
+    if (!config::lake_enable_segment_meta_bundle) {
+        return Status::OK();
+    }
+    auto bundle = rowset_segment_meta_bundle_filename(rowset.segments(), segment_offset);
+    if (!bundle.empty()) {
+        return deleter->delete_file(join_path(base_dir, bundle));
+    }
+    return Status::OK();
+}
+
 static Status collect_garbage_files(const TabletMetadataPB& metadata, const std::string& base_dir,
                                     AsyncFileDeleter* deleter, int64_t* garbage_data_size) {
     for (const auto& rowset : metadata.compaction_inputs()) {
         for (const auto& segment : rowset.segments()) {
             RETURN_IF_ERROR(deleter->delete_file(join_path(base_dir, segment)));
         }
+        RETURN_IF_ERROR(delete_segment_meta_bundle(rowset, base_dir, deleter));
         for (const auto& del_file : rowset.del_files()) {
             RETURN_IF_ERROR(deleter->delete_file(join_path(base_dir, del_file.name())));
         }
@@ -450,22 +470,74 @@ static Status vacuum_tablet_metadata(TabletManager* tablet_mgr, std::string_view
         vacuum_version_range = std::make_unique<VacuumTabletMetaVerionRange>();
     }
     int64_t final_vacuum_version = std::numeric_limits<int64_t>::max();
-    for (auto& tablet_info : tablet_infos) {
+    // protects the output parameters, |vacuum_version_range| and |final_vacuum_version|
+    std::mutex mutex;
+    auto vacuum_tablet = [&](TabletInfoPB& tablet_info) -> Status {
         int64_t tablet_vacuumed_version = 0;
+        int64_t tablet_vacuumed_file_size = 0;
+        int64_t tablet_extra_file_size = 0;
+        int64_t tablet_vacuumed_files = 0;
+        VacuumTabletMetaVerionRange tablet_version_range;
         AsyncFileDeleter datafile_deleter(config::lake_vacuum_min_batch_delete_size);
         AsyncFileDeleter metafile_deleter(INT64_MAX, metafile_delete_cb);
-        RETURN_IF_ERROR(collect_files_to_vacuum(tablet_mgr, root_dir, tablet_info, grace_timestamp, min_retain_version,
-                                                vacuum_version_range.get(), &datafile_deleter, &metafile_deleter,
-                                                vacuumed_file_size, &tablet_vacuumed_version, extra_file_size));
+        RETURN_IF_ERROR(collect_files_to_vacuum(
+                tablet_mgr, root_dir, tablet_info, grace_timestamp, min_retain_version,
+                enable_partition_aggregation ? &tablet_version_range : nullptr, &datafile_deleter, &metafile_deleter,
+                &tablet_vacuumed_file_size, &tablet_vacuumed_version, &tablet_extra_file_size));
         RETURN_IF_ERROR(datafile_deleter.finish());
-        (*vacuumed_files) += datafile_deleter.delete_count();
+        tablet_vacuumed_files += datafile_deleter.delete_count();
         if (!enable_partition_aggregation) {
             RETURN_IF_ERROR(metafile_deleter.finish());
-            (*vacuumed_files) += metafile_deleter.delete_count();
+            tablet_vacuumed_files += metafile_deleter.delete_count();
+        }
+
+        std::lock_guard l(mutex);
+        (*vacuumed_files) += tablet_vacuumed_files;
+        (*vacuumed_file_size) += tablet_vacuumed_file_size;
+        (*extra_file_size) += tablet_extra_file_size;
+        if (tablet_version_range.min_version != 0 || tablet_version_range.max_version != 0) {
+            vacuum_version_range->merge(tablet_version_range.min_version, tablet_version_range.max_version);
         }
         // set partition vacuumed_version to min tablet vacuumed version
         final_vacuum_version = std::min(final_vacuum_version, tablet_vacuumed_version);
+        return Status::OK();
+    };
+
+    // Tablets are independent of each other, process them with up to |parallelism| workers, each of which takes
+    // the next unprocessed tablet until all tablets are done or some tablet fails. The calling thread is one of
+    // the workers, so the request still makes progress if no task can be submitted to the thread pool.
+    const auto num_tablets = tablet_infos.size();
+    std::atomic<size_t> next_tablet{0};
+    Status ret;
+    auto worker = [&]() {
+        for (size_t i = next_tablet.fetch_add(1); i < num_tablets; i = next_tablet.fetch_add(1)) {
+            auto st = vacuum_tablet(tablet_infos[i]);
+            if (!st.ok()) {
+                std::lock_guard l(mutex);
+                ret.update(st);
+                next_tablet.store(num_tablets);
+                break;
+            }
+        }
+    };
+    auto thread_pool = ExecEnv::GetInstance()->lake_vacuum_tablet_thread_pool();
+    size_t parallelism = std::min<size_t>(std::max(1, config::lake_vacuum_tablet_parallelism), num_tablets);
+    if (thread_pool == nullptr || parallelism <= 1) {
+        parallelism = 1;
     }
+    CountDownLatch latch(static_cast<int>(parallelism - 1));
+    for (size_t i = 1; i < parallelism; i++) {
+        auto st = thread_pool->submit_func([&]() {
+            worker();
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            latch.count_down();
+        }
+    }
+    worker();
+    latch.wait();
+    RETURN_IF_ERROR(ret);
     if (enable_partition_aggregation) {
         // collect meta files to vacuum at partition level
         AsyncFileDeleter metafile_deleter(INT64_MAX, metafile_delete_cb);
@@ -656,6 +728,7 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
                 for (const auto& segment : op.rowset().segments()) {
                     RETURN_IF_ERROR(deleter.delete_file(join_path(data_dir, segment)));
                 }
+                RETURN_IF_ERROR(delete_segment_meta_bundle(op.rowset(), data_dir, &deleter));
                 for (const auto& f : op.dels()) {
                     RETURN_IF_ERROR(deleter.delete_file(join_path(data_dir, f)));
                 }
@@ -665,6 +738,8 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
                 for (const auto& segment : op.output_rowset().segments()) {
                     RETURN_IF_ERROR(deleter.delete_file(join_path(data_dir, segment)));
                 }
+                RETURN_IF_ERROR(delete_segment_meta_bundle(op.output_rowset(), data_dir, &deleter,
+                                                           op.new_segment_offset()));
             }
             if (log->has_op_schema_change()) {
                 const auto& op = log->op_schema_change();
@@ -672,6 +747,7 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
                     for (const auto& segment : rowset.segments()) {
                         RETURN_IF_ERROR(deleter.delete_file(join_path(data_dir, segment)));
                     }
+                    RETURN_IF_ERROR(delete_segment_meta_bundle(rowset, data_dir, &deleter));
                 }
             }
             RETURN_IF_ERROR(deleter.delete_file(join_path(log_dir, log_name)));
@@ -725,6 +801,7 @@ Status delete_tablets_impl(TabletManager* tablet_mgr, const std::string& root_di
                 for (const auto& segment : rowset.segments()) {
                     RETURN_IF_ERROR(deleter.delete_file(join_path(data_dir, segment)));
                 }
+                RETURN_IF_ERROR(delete_segment_meta_bundle(rowset, data_dir, &deleter));
             }
             if (latest_metadata->has_delvec_meta()) {
                 for (const auto& [v, f] : latest_metadata->delvec_meta().version_to_file()) {
@@ -832,8 +909,9 @@ static StatusOr<std::map<std::string, DirEntry>> list_data_files(FileSystem* fs,
                                                   total_files++;
                                                   total_bytes += entry.size.value_or(0);
 
-                                                  if (!is_segment(entry.name) &&
-                                                      !is_sst(entry.name)) { // Only segment files and sst
+                                                  // Only segment files, segment meta bundles and sst
+                                                  if (!is_segment(entry.name) && !is_sst(entry.name) &&
+                                                      !is_segment_meta_bundle(entry.name)) {
                                                       return true;
                                                   }
                                                   if (!entry.mtime.has_value()) {
@@ -871,6 +949,13 @@ static StatusOr<std::map<std::string, DirEntry>> find_orphan_data_files(FileSyst
         for (const auto& segment : rowset.segments()) {
             data_files.erase(segment);
             data_files_in_metadatas.emplace(segment);
+            // the bundle of a compaction output is named after its first new segment, which may not be the first
+            // segment of the rowset, so keep the bundle named after any segment of the rowset.
+            if (rowset.segments_size() > 1) {
+                auto bundle = segment_meta_bundle_filename(segment);
+                data_files.erase(bundle);
+                data_files_in_metadatas.emplace(std::move(bundle));
+            }
         }
     };
     auto check_sst_meta = [&](const PersistentIndexSstableMetaPB& sst_meta) {
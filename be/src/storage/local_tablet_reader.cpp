@@ -14,16 +14,23 @@
 
 #include "storage/local_tablet_reader.h"
 
+#include <numeric>
+
+#include "column/column_helper.h"
 #include "gen_cpp/internal_service.pb.h"
+#include "gutil/casts.h"
 #include "serde/protobuf_serde.h"
 #include "storage/chunk_helper.h"
 #include "storage/primary_index.h"
 #include "storage/primary_key_encoder.h"
+#include "storage/primary_key_row_cache.h"
 #include "storage/projection_iterator.h"
+#include "storage/row_store_encoder_factory.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_updates.h"
+#include "storage/update_manager.h"
 
 namespace starrocks {
 
@@ -110,33 +117,10 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
 
     // convert keys to pk single column format
     const auto& tablet_schema = _tablet->tablet_schema();
-    vector<uint32_t> pk_columns;
-    for (size_t i = 0; i < tablet_schema->num_key_columns(); i++) {
-        pk_columns.push_back((uint32_t)i);
-    }
     MutableColumnPtr pk_column;
     RETURN_IF_ERROR(PrimaryKeyEncoder::create_column(*tablet_schema->schema(), &pk_column));
     PrimaryKeyEncoder::encode(*tablet_schema->schema(), keys, 0, keys.num_rows(), pk_column.get());
 
-    // search pks in pk index to get rowids
-    EditVersion edit_version;
-    std::vector<uint64_t> rowids(n);
-    RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), *pk_column, &edit_version, &rowids));
-    if (edit_version.major_number() != _version) {
-        return Status::InternalError(
-                strings::Substitute("multi_get version not match tablet:$0 current_version:$1 read_version:$2",
-                                    _tablet->tablet_id(), edit_version.to_string(), _version));
-    }
-    if (rowids.size() != n) {
-        return Status::InternalError(strings::Substitute("multi_get rowid size not match tablet:$0 $1 != $2",
-                                                         _tablet->tablet_id(), rowids.size(), n));
-    }
-
-    // sort rowids by rssid, so we can plan&perform read operations by rowset/segment
-    std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
-    vector<uint32_t> idxes;
-    plan_read_by_rssid(rowids, found, rowids_by_rssid, idxes);
-
     auto read_column_schema = ChunkHelper::convert_schema(tablet_schema, value_column_ids);
     vector<std::pair<uint32_t, uint32_t>> value_column_ids_by_order_with_orig_idx;
     for (uint32_t i = 0; i < value_column_ids.size(); ++i) {
@@ -151,8 +135,29 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
     for (uint32_t i = 0; i < read_columns.size(); ++i) {
         read_columns[i] = ChunkHelper::column_from_field(*read_column_schema.field(i).get())->clone_empty();
     }
-    RETURN_IF_ERROR(_tablet->updates()->get_column_values(value_column_ids_by_order, _version, false, rowids_by_rssid,
-                                                          &read_columns, nullptr, tablet_schema));
+
+    vector<uint32_t> idxes;
+    size_t num_cache_hits = 0;
+    auto* row_cache = _get_row_cache(value_column_ids_by_order);
+    if (row_cache != nullptr) {
+        RETURN_IF_ERROR(_multi_get_by_row_cache(row_cache, *pk_column, value_column_ids_by_order, found, &read_columns,
+                                                &num_cache_hits));
+        // values are read in the order of keys
+        idxes.resize(read_columns[0]->size());
+        std::iota(idxes.begin(), idxes.end(), 0);
+    } else {
+        // search pks in pk index to get rowids
+        EditVersion edit_version;
+        std::vector<uint64_t> rowids(n);
+        RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), *pk_column, &edit_version, &rowids));
+        RETURN_IF_ERROR(_check_read_version(edit_version, rowids.size(), n));
+
+        // sort rowids by rssid, so we can plan&perform read operations by rowset/segment
+        std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
+        plan_read_by_rssid(rowids, found, rowids_by_rssid, idxes);
+        RETURN_IF_ERROR(_tablet->updates()->get_column_values(value_column_ids_by_order, _version, false,
+                                                              rowids_by_rssid, &read_columns, nullptr, tablet_schema));
+    }
 
     // reorder read values to input keys' order and put into values output parameter
     values.reset();
@@ -161,12 +166,111 @@ Status LocalTabletReader::multi_get(const Chunk& keys, const std::vector<uint32_
                 ->append_selective(*read_columns[col_idx], idxes.data(), 0, idxes.size());
     }
     int64_t t_end = MonotonicMillis();
-    LOG(INFO) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 found:$4 time:$5ms",
-                                     _tablet->tablet_id(), _version, value_column_ids.size(), n, idxes.size(),
-                                     t_end - t_start);
+    VLOG(1) << strings::Substitute("multi_get tablet:$0 version:$1 #columns:$2 #rows:$3 found:$4 cache_hit:$5 time:$6ms",
+                                   _tablet->tablet_id(), _version, value_column_ids.size(), n, idxes.size(),
+                                   num_cache_hits, t_end - t_start);
     return Status::OK();
 }
 
+Status LocalTabletReader::_check_read_version(const EditVersion& edit_version, size_t num_rowids, size_t num_keys) {
+    if (edit_version.major_number() != _version) {
+        return Status::InternalError(
+                strings::Substitute("multi_get version not match tablet:$0 current_version:$1 read_version:$2",
+                                    _tablet->tablet_id(), edit_version.to_string(), _version));
+    }
+    if (num_rowids != num_keys) {
+        return Status::InternalError(strings::Substitute("multi_get rowid size not match tablet:$0 $1 != $2",
+                                                         _tablet->tablet_id(), num_rowids, num_keys));
+    }
+    return Status::OK();
+}
+
+PrimaryKeyRowCache* LocalTabletReader::_get_row_cache(const std::vector<uint32_t>& value_column_ids_by_order) const {
+    if (!_tablet->is_column_with_row_store() || value_column_ids_by_order.empty()) {
+        return nullptr;
+    }
+    // only value columns can be decoded from the full row column
+    const auto& tablet_schema = _tablet->tablet_schema();
+    if (value_column_ids_by_order.front() < tablet_schema->num_key_columns() ||
+        value_column_ids_by_order.back() >= tablet_schema->num_columns() - 1) {
+        return nullptr;
+    }
+    return StorageEngine::instance()->update_manager()->pk_row_cache();
+}
+
+Status LocalTabletReader::_multi_get_by_row_cache(PrimaryKeyRowCache* row_cache, const Column& pk_column,
+                                                  const std::vector<uint32_t>& value_column_ids_by_order,
+                                                  std::vector<bool>& found, MutableColumns* read_columns,
+                                                  size_t* num_cache_hits) {
+    const auto& tablet_schema = _tablet->tablet_schema();
+    int64_t tablet_id = _tablet->tablet_id();
+    size_t n = pk_column.size();
+
+    // 1. probe full rows in row cache
+    std::vector<uint8_t> hits;
+    auto cached_rows = BinaryColumn::create();
+    int64_t generation = row_cache->multi_get(tablet_id, _version, pk_column, &hits, cached_rows.get());
+    *num_cache_hits = cached_rows->size();
+    std::vector<uint32_t> miss_idxes;
+    for (uint32_t i = 0; i < n; i++) {
+        if (!hits[i]) {
+            miss_idxes.push_back(i);
+        }
+    }
+
+    // 2. read full rows of the missed keys, primary index is probed once for all of them
+    std::vector<bool> miss_found;
+    auto loaded_rows = BinaryColumn::create();
+    if (!miss_idxes.empty()) {
+        auto miss_pks = pk_column.clone_empty();
+        miss_pks->append_selective(pk_column, miss_idxes.data(), 0, miss_idxes.size());
+        EditVersion edit_version;
+        std::vector<uint64_t> rowids(miss_idxes.size());
+        RETURN_IF_ERROR(_tablet->updates()->get_rss_rowids_by_pk(_tablet.get(), *miss_pks, &edit_version, &rowids));
+        RETURN_IF_ERROR(_check_read_version(edit_version, rowids.size(), miss_idxes.size()));
+
+        std::map<uint32_t, std::vector<uint32_t>> rowids_by_rssid;
+        vector<uint32_t> idxes;
+        plan_read_by_rssid(rowids, miss_found, rowids_by_rssid, idxes);
+        const auto& row_column = tablet_schema->column(tablet_schema->num_columns() - 1);
+        MutableColumns row_columns(1);
+        row_columns[0] = ChunkHelper::column_from_field_type(row_column.type(), row_column.is_nullable());
+        RETURN_IF_ERROR(_tablet->updates()->get_column_values({(uint32_t)tablet_schema->num_columns() - 1}, _version,
+                                                              false, rowids_by_rssid, &row_columns, nullptr,
+                                                              tablet_schema));
+        auto* rows = down_cast<BinaryColumn*>(ColumnHelper::get_data_column(row_columns[0].get()));
+        loaded_rows->append_selective(*rows, idxes.data(), 0, idxes.size());
+
+        std::vector<uint32_t> found_idxes;
+        for (size_t i = 0; i < miss_idxes.size(); i++) {
+            if (miss_found[i]) {
+                found_idxes.push_back(miss_idxes[i]);
+            }
+        }
+        row_cache->insert(tablet_id, _version, generation, pk_column, found_idxes, *loaded_rows);
+    }
+
+    // 3. merge cached and loaded rows in the order of keys, and decode the value columns
+    found.assign(n, false);
+    auto full_rows = BinaryColumn::create();
+    full_rows->reserve(cached_rows->size() + loaded_rows->size());
+    size_t cached_pos = 0;
+    size_t miss_pos = 0;
+    size_t loaded_pos = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (hits[i]) {
+            found[i] = true;
+            full_rows->append(cached_rows->get_slice(cached_pos++));
+        } else if (miss_found[miss_pos++]) {
+            found[i] = true;
+            full_rows->append(loaded_rows->get_slice(loaded_pos++));
+        }
+    }
+    auto row_encoder = RowStoreEncoderFactory::instance()->get_or_create_encoder(SIMPLE);
+    return row_encoder->decode_columns_from_full_row_column(*tablet_schema->schema(), *full_rows,
+                                                            value_column_ids_by_order, read_columns);
+}
+
 StatusOr<ChunkIteratorPtr> LocalTabletReader::scan(const std::vector<std::string>& value_columns,
                                                    const std::vector<const ColumnPredicate*>& predicates) {
     TabletReaderParams tablet_reader_params;
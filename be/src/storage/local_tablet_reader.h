@@ -20,6 +20,8 @@
 namespace starrocks {
 
 class ColumnPredicate;
+struct EditVersion;
+class PrimaryKeyRowCache;
 class PTabletReaderMultiGetRequest;
 class PTabletReaderMultiGetResult;
 
@@ -46,6 +48,17 @@ public:
                                     const std::vector<const ColumnPredicate*>& predicates);
 
 private:
+    Status _check_read_version(const EditVersion& edit_version, size_t num_rowids, size_t num_keys);
+
+    // Return the row cache if the values can be decoded from the full row column, otherwise nullptr.
+    PrimaryKeyRowCache* _get_row_cache(const std::vector<uint32_t>& value_column_ids_by_order) const;
+
+    // Point lookup of full rows through the row cache, only the missed keys are searched in primary index.
+    // `read_columns` are filled in the order of found keys.
+    Status _multi_get_by_row_cache(PrimaryKeyRowCache* row_cache, const Column& pk_column,
+                                   const std::vector<uint32_t>& value_column_ids_by_order, std::vector<bool>& found,
+                                   MutableColumns* read_columns, size_t* num_cache_hits);
+
     TabletSharedPtr _tablet;
     int64_t _version{0};
 };
@@ -2273,11 +2273,33 @@ Status ShardByLengthMutableIndex::create_index_file(std::string& path) {
 #ifdef __SSE2__
 
 #include <emmintrin.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 size_t get_matched_tag_idxes(const uint8_t* tags, size_t ntag, uint8_t tag, uint8_t* matched_idxes) {
     size_t nmatched = 0;
+    size_t i = 0;
+#ifdef __AVX2__
+    // tags area is padded to kPackSize(16) only, so 32 tags are compared at a time as long as they are all
+    // inside the padded area, the rest is handled by the SSE loop.
+    const size_t padded_ntag = pad(ntag, kPackSize);
+    auto tests32 = _mm256_set1_epi8(tag);
+    for (; i + 32 <= padded_ntag; i += 32) {
+        auto tags32 = _mm256_loadu_si256((const __m256i*)(tags + i));
+        auto eqs = _mm256_cmpeq_epi8(tags32, tests32);
+        uint32_t mask = _mm256_movemask_epi8(eqs);
+        while (mask != 0) {
+            uint32_t match_pos = __builtin_ctz(mask);
+            if (i + match_pos < ntag) {
+                matched_idxes[nmatched++] = i + match_pos;
+            }
+            mask &= (mask - 1);
+        }
+    }
+#endif
     auto tests = _mm_set1_epi8(tag);
-    for (size_t i = 0; i < ntag; i += 16) {
+    for (; i < ntag; i += 16) {
         auto tags16 = _mm_load_si128((__m128i*)(tags + i));
         auto eqs = _mm_cmpeq_epi8(tags16, tests);
         auto mask = _mm_movemask_epi8(eqs);
@@ -2368,13 +2390,30 @@ Status ImmutableIndex::_get_kvs_for_shard(std::vector<std::vector<KVRef>>& kvs_b
     }
 }
 
+// Keys of a shard are probed in hash order, so their buckets are scattered randomly in the shard and each probe
+// is likely to miss the cache. Prefetch the bucket of a later key while probing the current one to hide the latency.
+static constexpr size_t kGetPrefetchDistance = 8;
+// max number of adjacent pages fetched by one read in `_get_in_shard_by_page`.
+static constexpr size_t kMaxCoalescedPages = 16;
+
+static inline void prefetch_bucket(ImmutableIndexShard* shard, uint32_t npage, uint32_t nbucket, uint64_t hash) {
+    IndexHash h(hash);
+    const auto& bucket_info = shard->bucket(h.page() % npage, h.bucket() % nbucket);
+    __builtin_prefetch(shard->pack_in_page(bucket_info.pageid, bucket_info.packid));
+}
+
 Status ImmutableIndex::_get_in_fixlen_shard(size_t shard_idx, size_t n, const Slice* keys,
                                             const std::vector<KeyInfo>& keys_info, IndexValue* values,
                                             KeysInfo* found_keys_info,
                                             std::unique_ptr<ImmutableIndexShard>* shard) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (const auto& key_info : keys_info) {
+    for (size_t i = 0; i < keys_info.size(); i++) {
+        if (i + kGetPrefetchDistance < keys_info.size()) {
+            prefetch_bucket(shard->get(), shard_info.npage, shard_info.nbucket,
+                            keys_info[i + kGetPrefetchDistance].second);
+        }
+        const auto& key_info = keys_info[i];
         IndexHash h(key_info.second);
         auto pageid = h.page() % shard_info.npage;
         auto bucketid = h.bucket() % shard_info.nbucket;
@@ -2406,7 +2445,12 @@ Status ImmutableIndex::_get_in_varlen_shard(size_t shard_idx, size_t n, const Sl
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
 
-    for (const auto& key_info : keys_info) {
+    for (size_t i = 0; i < keys_info.size(); i++) {
+        if (i + kGetPrefetchDistance < keys_info.size()) {
+            prefetch_bucket(shard->get(), shard_info.npage, shard_info.nbucket,
+                            keys_info[i + kGetPrefetchDistance].second);
+        }
+        const auto& key_info = keys_info[i];
         IndexHash h(key_info.second);
         auto pageid = h.page() % shard_info.npage;
         auto bucketid = h.bucket() % shard_info.nbucket;
@@ -2530,13 +2574,53 @@ Status ImmutableIndex::_read_page(size_t shard_idx, size_t pageid, LargeIndexPag
     return Status::OK();
 }
 
+Status ImmutableIndex::_read_pages(size_t shard_idx, size_t first_pageid, size_t npage,
+                                  std::map<size_t, LargeIndexPage>* pages, IOStat* stat) const {
+    if (npage == 1) {
+        LargeIndexPage page(_shards[shard_idx].page_size / kPageSize);
+        RETURN_IF_ERROR(_read_page(shard_idx, first_pageid, &page, stat));
+        (*pages)[first_pageid] = std::move(page);
+        return Status::OK();
+    }
+    const auto& shard_info = _shards[shard_idx];
+    const bool compressed = _compression_type != CompressionTypePB::NO_COMPRESSION;
+    auto page_begin = [&](size_t pageid) -> size_t {
+        return compressed ? shard_info.page_off[pageid] : shard_info.page_size * pageid;
+    };
+    const size_t read_begin = page_begin(first_pageid);
+    const size_t read_bytes = page_begin(first_pageid + npage) - read_begin;
+    std::string buff;
+    raw::stl_string_resize_uninitialized(&buff, read_bytes);
+    RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset + read_begin, buff.data(), read_bytes));
+    const BlockCompressionCodec* codec = nullptr;
+    if (compressed) {
+        RETURN_IF_ERROR(get_block_compression_codec(_compression_type, &codec));
+    }
+    for (size_t pageid = first_pageid; pageid < first_pageid + npage; pageid++) {
+        LargeIndexPage page(shard_info.page_size / kPageSize);
+        Slice body(buff.data() + page_begin(pageid) - read_begin, page_begin(pageid + 1) - page_begin(pageid));
+        if (compressed) {
+            Slice decompressed_body((uint8_t*)page.data(), shard_info.page_size);
+            RETURN_IF_ERROR(codec->decompress(body, &decompressed_body));
+        } else {
+            memcpy(page.data(), body.data, body.size);
+        }
+        (*pages)[pageid] = std::move(page);
+    }
+    if (stat != nullptr) {
+        stat->read_iops++;
+        stat->read_io_bytes += read_bytes;
+    }
+    return Status::OK();
+}
+
 Status ImmutableIndex::_get_in_fixlen_shard_by_page(size_t shard_idx, size_t n, const Slice* keys, IndexValue* values,
                                                     KeysInfo* found_keys_info,
                                                     std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
                                                     std::map<size_t, LargeIndexPage>& pages) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (auto [_, keys_info] : keys_info_by_page) {
+    for (const auto& [_, keys_info] : keys_info_by_page) {
         for (size_t i = 0; i < keys_info.size(); i++) {
             IndexHash h(keys_info[i].second);
             auto pageid = h.page() % shard_info.npage;
@@ -2584,7 +2668,7 @@ Status ImmutableIndex::_get_in_varlen_shard_by_page(size_t shard_idx, size_t n,
                                                     std::map<size_t, LargeIndexPage>& pages) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (auto [_, keys_info] : keys_info_by_page) {
+    for (const auto& [_, keys_info] : keys_info_by_page) {
         for (size_t i = 0; i < keys_info.size(); i++) {
             IndexHash h(keys_info[i].second);
             auto pageid = h.page() % shard_info.npage;
@@ -2635,10 +2719,17 @@ Status ImmutableIndex::_get_in_shard_by_page(size_t shard_idx, size_t n, const S
                                              IOStat* stat) const {
     const auto& shard_info = _shards[shard_idx];
     std::map<size_t, LargeIndexPage> pages;
-    for (auto [pageid, keys_info] : keys_info_by_page) {
-        LargeIndexPage page(shard_info.page_size / kPageSize);
-        RETURN_IF_ERROR(_read_page(shard_idx, pageid, &page, stat));
-        pages[pageid] = std::move(page);
+    // keys_info_by_page is ordered by pageid, so adjacent pages can be fetched by one read.
+    auto iter = keys_info_by_page.begin();
+    while (iter != keys_info_by_page.end()) {
+        size_t first_pageid = iter->first;
+        size_t npage = 1;
+        for (++iter; iter != keys_info_by_page.end() && iter->first == first_pageid + npage &&
+                     npage < kMaxCoalescedPages;
+             ++iter) {
+            npage++;
+        }
+        RETURN_IF_ERROR(_read_pages(shard_idx, first_pageid, npage, &pages, stat));
     }
     if (shard_info.key_size != 0) {
         return _get_in_fixlen_shard_by_page(shard_idx, n, keys, values, found_keys_info, keys_info_by_page, pages);
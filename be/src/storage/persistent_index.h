@@ -554,6 +554,10 @@ private:
 
     Status _read_page(size_t shard_idx, size_t pageid, LargeIndexPage* page, IOStat* stat) const;
 
+    // read [first_pageid, first_pageid + npage) of the shard by one IO and put the (decompressed) pages into |pages|.
+    Status _read_pages(size_t shard_idx, size_t first_pageid, size_t npage, std::map<size_t, LargeIndexPage>* pages,
+                       IOStat* stat) const;
+
     Status _get_in_shard_by_page(size_t shard_idx, size_t n, const Slice* keys, IndexValue* values,
                                  KeysInfo* found_keys_info, std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
                                  IOStat* stat) const;
@@ -0,0 +1,223 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/primary_key_row_cache.h"
+
+#include "runtime/mem_tracker.h"
+#include "util/time.h"
+
+namespace starrocks {
+
+namespace {
+struct CachedRow {
+    int64_t version;
+    int64_t generation;
+    std::string row;
+    MemTracker* mem_tracker;
+    size_t charge;
+};
+
+void delete_cached_row(const CacheKey& /*key*/, void* value) {
+    auto* cached = reinterpret_cast<CachedRow*>(value);
+    if (cached->mem_tracker != nullptr) {
+        cached->mem_tracker->release(cached->charge);
+    }
+    delete cached;
+}
+
+// approximate memory of a tablet state and its slot in the hash map
+constexpr size_t kTabletStateCharge = 128;
+
+void encode_cache_key(int64_t tablet_id, const Slice& pk, std::string* key) {
+    key->clear();
+    key->append(reinterpret_cast<const char*>(&tablet_id), sizeof(tablet_id));
+    key->append(pk.data, pk.size);
+}
+
+void get_pk_slices(const Column& pks, std::vector<Slice>* keys) {
+    if (pks.is_binary() || pks.is_large_binary()) {
+        const auto* slices = reinterpret_cast<const Slice*>(pks.raw_data());
+        keys->assign(slices, slices + pks.size());
+    } else {
+        size_t key_size = pks.type_size();
+        const uint8_t* data = pks.raw_data();
+        keys->reserve(pks.size());
+        for (size_t i = 0; i < pks.size(); i++) {
+            keys->emplace_back(data + i * key_size, key_size);
+        }
+    }
+}
+} // namespace
+
+PrimaryKeyRowCache::PrimaryKeyRowCache(size_t capacity, MemTracker* mem_tracker)
+        : _cache(new_lru_cache(capacity)), _mem_tracker(mem_tracker) {}
+
+PrimaryKeyRowCache::~PrimaryKeyRowCache() {
+    // release the memory of cached rows before the tracker of states is released
+    _cache.reset();
+    if (_mem_tracker != nullptr) {
+        _mem_tracker->release(_states.size() * kTabletStateCharge);
+    }
+}
+
+PrimaryKeyRowCache::TabletStatePtr PrimaryKeyRowCache::_get_or_create_state(int64_t tablet_id) {
+    std::lock_guard l(_states_mutex);
+    auto& state = _states[tablet_id];
+    if (state == nullptr) {
+        state = std::make_shared<TabletState>();
+        state->generation = ++_next_generation;
+        if (_mem_tracker != nullptr) {
+            _mem_tracker->consume(kTabletStateCharge);
+        }
+    }
+    state->last_access_ms = MonotonicMillis();
+    return state;
+}
+
+size_t PrimaryKeyRowCache::prune_states(int64_t expire_ms) {
+    int64_t now = MonotonicMillis();
+    size_t pruned = 0;
+    std::lock_guard l(_states_mutex);
+    for (auto it = _states.begin(); it != _states.end();) {
+        const auto& state = it->second;
+        // the state is referenced by nobody else when use_count() is 1, because references are only handed out by
+        // _get_or_create_state() under _states_mutex.
+        bool expired = state.use_count() == 1 && now - state->last_access_ms > expire_ms;
+        if (expired) {
+            std::lock_guard state_lock(state->mutex);
+            expired = !state->applying;
+        }
+        if (expired) {
+            it = _states.erase(it);
+            pruned++;
+        } else {
+            ++it;
+        }
+    }
+    if (_mem_tracker != nullptr) {
+        _mem_tracker->release(pruned * kTabletStateCharge);
+    }
+    return pruned;
+}
+
+size_t PrimaryKeyRowCache::num_states() const {
+    std::lock_guard l(_states_mutex);
+    return _states.size();
+}
+
+size_t PrimaryKeyRowCache::memory_usage() const {
+    return _cache->get_memory_usage() + num_states() * kTabletStateCharge;
+}
+
+int64_t PrimaryKeyRowCache::multi_get(int64_t tablet_id, int64_t read_version, const Column& pks,
+                                      std::vector<uint8_t>* hits, BinaryColumn* rows) {
+    hits->assign(pks.size(), 0);
+    auto state = _get_or_create_state(tablet_id);
+    int64_t version;
+    int64_t generation;
+    {
+        std::lock_guard l(state->mutex);
+        version = state->version;
+        generation = state->generation;
+    }
+    if (read_version > version) {
+        return generation;
+    }
+    std::vector<Slice> keys;
+    get_pk_slices(pks, &keys);
+    std::string key;
+    for (size_t i = 0; i < keys.size(); i++) {
+        encode_cache_key(tablet_id, keys[i], &key);
+        auto* handle = _cache->lookup(CacheKey(key));
+        if (handle == nullptr) {
+            continue;
+        }
+        const auto* cached = reinterpret_cast<const CachedRow*>(_cache->value(handle));
+        if (cached->generation == generation && cached->version <= read_version) {
+            rows->append(Slice(cached->row));
+            (*hits)[i] = 1;
+        }
+        _cache->release(handle);
+    }
+    return generation;
+}
+
+void PrimaryKeyRowCache::insert(int64_t tablet_id, int64_t read_version, int64_t generation, const Column& pks,
+                                const std::vector<uint32_t>& idxes, const BinaryColumn& rows) {
+    DCHECK_EQ(idxes.size(), rows.size());
+    auto state = _get_or_create_state(tablet_id);
+    std::vector<Slice> keys;
+    get_pk_slices(pks, &keys);
+    std::string key;
+    // insert under the lock of tablet state, so that begin_apply() can not interleave
+    std::lock_guard l(state->mutex);
+    if (state->applying || state->generation != generation) {
+        return;
+    }
+    if (state->version == -1) {
+        // the first load after the tablet state is created or invalidated.
+        state->version = read_version;
+    } else if (state->version != read_version) {
+        return;
+    }
+    for (size_t i = 0; i < idxes.size(); i++) {
+        encode_cache_key(tablet_id, keys[idxes[i]], &key);
+        Slice row = rows.get_slice(i);
+        size_t charge = sizeof(CachedRow) + key.size() + row.size;
+        auto* cached = new CachedRow{read_version, generation, row.to_string(), _mem_tracker, charge};
+        if (_mem_tracker != nullptr) {
+            _mem_tracker->consume(charge);
+        }
+        auto* handle = _cache->insert(CacheKey(key), cached, charge, &delete_cached_row);
+        _cache->release(handle);
+    }
+}
+
+void PrimaryKeyRowCache::begin_apply(int64_t tablet_id) {
+    auto state = _get_or_create_state(tablet_id);
+    std::lock_guard l(state->mutex);
+    state->applying = true;
+}
+
+void PrimaryKeyRowCache::erase(int64_t tablet_id, const Column& pks) {
+    std::vector<Slice> keys;
+    get_pk_slices(pks, &keys);
+    std::string key;
+    for (const auto& pk : keys) {
+        encode_cache_key(tablet_id, pk, &key);
+        _cache->erase(CacheKey(key));
+    }
+}
+
+void PrimaryKeyRowCache::end_apply(int64_t tablet_id, int64_t version) {
+    auto state = _get_or_create_state(tablet_id);
+    std::lock_guard l(state->mutex);
+    state->applying = false;
+    if (version < 0) {
+        // the keys may be partially erased, drop all the rows of the tablet
+        state->version = -1;
+        state->generation = ++_next_generation;
+    } else {
+        state->version = version;
+    }
+}
+
+void PrimaryKeyRowCache::invalidate(int64_t tablet_id) {
+    auto state = _get_or_create_state(tablet_id);
+    std::lock_guard l(state->mutex);
+    state->version = -1;
+    state->generation = ++_next_generation;
+}
+
+} // namespace starrocks
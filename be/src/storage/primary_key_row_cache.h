@@ -0,0 +1,100 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "column/binary_column.h"
+#include "column/column.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+class MemTracker;
+
+// PrimaryKeyRowCache caches the encoded full rows(the value of row store column) of primary key tablets, it is
+// keyed by (tablet_id, encoded primary key) and used by point lookups of short circuit queries to skip the probe
+// of primary index and the read of segment files.
+//
+// Each tablet has a state of (version, generation, applying) that guards the consistency of cached rows:
+//  - apply of a rowset calls begin_apply() before the primary index is updated, erases the upserted and deleted
+//    keys, and calls end_apply() with the new version at the end, rows loaded before or during the apply are not
+//    allowed to be inserted after that.
+//  - other changes of the tablet data(e.g. partial update by column, clone) call invalidate() to drop all the
+//    cached rows of the tablet by bumping generation.
+// A cached row loaded at version v is valid for the read version rv if v <= rv <= the version of tablet state.
+// Generations are unique across tablets and states, so the rows cached before a tablet state is pruned by
+// prune_states() or invalidated never match the state again.
+class PrimaryKeyRowCache {
+public:
+    // The memory of cached rows and tablet states is consumed from `mem_tracker` if it is not nullptr.
+    explicit PrimaryKeyRowCache(size_t capacity, MemTracker* mem_tracker = nullptr);
+    ~PrimaryKeyRowCache();
+
+    // Probe the rows of `pks` at `read_version`, `hits[i]` is set to 1 if the row of `pks[i]` is found, and the
+    // found rows are appended to `rows` in the order of keys. Return the generation of tablet state, which should
+    // be passed to the following insert() of the rows loaded from storage.
+    int64_t multi_get(int64_t tablet_id, int64_t read_version, const Column& pks, std::vector<uint8_t>* hits,
+                      BinaryColumn* rows);
+
+    // Cache the rows loaded at `read_version`, `rows[i]` is the row of `pks[idxes[i]]`. Rows are dropped if the
+    // tablet is changed since multi_get() returns `generation`.
+    void insert(int64_t tablet_id, int64_t read_version, int64_t generation, const Column& pks,
+                const std::vector<uint32_t>& idxes, const BinaryColumn& rows);
+
+    void begin_apply(int64_t tablet_id);
+    void erase(int64_t tablet_id, const Column& pks);
+    // `version` is the new applied version, or -1 if the apply is failed.
+    void end_apply(int64_t tablet_id, int64_t version);
+
+    void invalidate(int64_t tablet_id);
+
+    // Drop the states of tablets which are neither accessed in the last `expire_ms` milliseconds nor applying,
+    // e.g. the tablets that are dropped or not queried any more. Return the number of dropped states.
+    size_t prune_states(int64_t expire_ms);
+    size_t num_states() const;
+
+    // the memory of cached rows and tablet states
+    size_t memory_usage() const;
+    size_t capacity() const { return _cache->get_capacity(); }
+    size_t lookup_count() const { return _cache->get_lookup_count(); }
+    size_t hit_count() const { return _cache->get_hit_count(); }
+
+private:
+    struct TabletState {
+        std::mutex mutex;
+        // -1 means unknown, no row can be hit before the version is known.
+        int64_t version = -1;
+        int64_t generation = 0;
+        bool applying = false;
+        std::atomic<int64_t> last_access_ms{0};
+    };
+    using TabletStatePtr = std::shared_ptr<TabletState>;
+
+    TabletStatePtr _get_or_create_state(int64_t tablet_id);
+
+    std::unique_ptr<Cache> _cache;
+    MemTracker* _mem_tracker;
+
+    mutable std::mutex _states_mutex;
+    std::unordered_map<int64_t, TabletStatePtr> _states;
+    std::atomic<int64_t> _next_generation{0};
+};
+
+} // namespace starrocks
@@ -228,6 +228,27 @@ Status Segment::open(size_t* footer_length_hint, const FooterPointerPB* partial_
     return res.status();
 }
 
+Status Segment::open_with_footer(SegmentFooterPB* footer) {
+    if (invoked(_open_once)) {
+        return Status::OK();
+    }
+
+    auto res = success_once(_open_once, [&] { return _open_with_footer(footer); });
+    if (res.ok() && *res) {
+        update_cache_size();
+    }
+    return res.status();
+}
+
+Status Segment::_open_with_footer(SegmentFooterPB* footer) {
+    // the footer of an encrypted segment is never kept outside the segment file
+    DCHECK(_segment_file_info.encryption_meta.empty());
+    RETURN_IF_ERROR(_create_column_readers(footer));
+    _num_rows = footer->num_rows();
+    _short_key_index_page = PagePointer(footer->short_key_index_page());
+    return Status::OK();
+}
+
 Status Segment::_open(size_t* footer_length_hint, const FooterPointerPB* partial_rowset_footer,
                       const LakeIOOptions& lake_io_opts) {
     SegmentFooterPB footer;
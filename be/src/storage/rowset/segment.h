@@ -104,6 +104,10 @@ public:
     Status open(size_t* footer_length_hint, const FooterPointerPB* partial_rowset_footer,
                 const LakeIOOptions& lake_io_opts);
 
+    // Open the segment with a footer that has been read from elsewhere, e.g. the segment meta bundle
+    // of a cloud native rowset, the segment file is not accessed.
+    Status open_with_footer(SegmentFooterPB* footer);
+
     // may return EndOfFile
     StatusOr<ChunkIteratorPtr> new_iterator(const Schema& schema, const SegmentReadOptions& read_options);
 
@@ -274,6 +278,7 @@ private:
     // open segment file and read the minimum amount of necessary information (footer)
     Status _open(size_t* footer_length_hint, const FooterPointerPB* partial_rowset_footer,
                  const LakeIOOptions& lake_io_opts);
+    Status _open_with_footer(SegmentFooterPB* footer);
     Status _create_column_readers(SegmentFooterPB* footer);
 
     StatusOr<ChunkIteratorPtr> _new_iterator(const Schema& schema, const SegmentReadOptions& read_options);
@@ -150,6 +150,9 @@ public:
 
     const std::string& encryption_meta() const { return _opts.encryption_meta; }
 
+    // The footer written to the segment file, only valid after the footer is finalized.
+    const SegmentFooterPB& footer() const { return _footer; }
+
 private:
     Status _write_short_key_index();
     Status _write_footer();
@@ -9,6 +9,7 @@
 
 namespace starrocks {
 class Cache;
+class ThreadPool;
 
 namespace sstable {
 
@@ -126,6 +127,14 @@ struct ReadOptions {
     uint64_t max_rss_rowid = 0;
 
     ReadIOStat* stat = nullptr;
+
+    // If non-null, data blocks missed in block cache that are needed by a
+    // MultiGet are read concurrently in this pool instead of one by one.
+    ThreadPool* prefetch_pool = nullptr;
+
+    // MultiGet processes the keys in windows which need at most this number
+    // of data blocks, so the blocks held by one MultiGet are bounded.
+    size_t max_multi_get_blocks = 64;
 };
 
 // Options that control write operations
@@ -8,6 +8,7 @@
 
 #include "common/status.h"
 #include "fs/fs.h"
+#include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/sstable/block.h"
@@ -18,7 +19,9 @@
 #include "storage/sstable/options.h"
 #include "storage/sstable/two_level_iterator.h"
 #include "util/coding.h"
+#include "util/countdown_latch.h"
 #include "util/lru_cache.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 
 namespace starrocks::sstable {
@@ -233,13 +236,74 @@ Iterator* Table::NewIterator(const ReadOptions& options) const {
                                const_cast<Table*>(this), options);
 }
 
+Iterator* Table::NewIndexIterator() const {
+    return rep_->index_block->NewIterator(rep_->options.comparator);
+}
+
+bool Table::BlockInCache(uint64_t offset) const {
+    Cache* block_cache = rep_->options.block_cache;
+    if (block_cache == nullptr) {
+        return false;
+    }
+    char cache_key_buffer[16];
+    encode_fixed64_le(reinterpret_cast<uint8_t*>(cache_key_buffer), rep_->cache_id);
+    encode_fixed64_le(reinterpret_cast<uint8_t*>(cache_key_buffer + 8), offset);
+    // it is only a probe, the block is looked up again when it is read.
+    return block_cache->contains(CacheKey(cache_key_buffer, sizeof(cache_key_buffer)));
+}
+
+Status Table::ReadBlocks(const ReadOptions& options, const std::map<uint64_t, std::string>& handles,
+                         std::map<uint64_t, std::unique_ptr<Iterator>>* iters) {
+    std::vector<std::pair<const std::string*, std::unique_ptr<Iterator>*>> missed_blocks;
+    for (const auto& [offset, handle_value] : handles) {
+        auto& iter = (*iters)[offset];
+        if (options.prefetch_pool != nullptr && !BlockInCache(offset)) {
+            missed_blocks.emplace_back(&handle_value, &iter);
+        } else {
+            iter.reset(BlockReader(this, options, handle_value));
+        }
+    }
+    if (missed_blocks.size() == 1) {
+        missed_blocks[0].second->reset(BlockReader(this, options, *missed_blocks[0].first));
+    } else if (missed_blocks.size() > 1) {
+        // Each task has its own io stat, they are merged after all tasks finish.
+        std::vector<ReadIOStat> stats(missed_blocks.size());
+        CountDownLatch latch(missed_blocks.size());
+        // the blocks read by the tasks are charged to the caller.
+        auto* mem_tracker = CurrentThread::mem_tracker();
+        for (size_t i = 0; i < missed_blocks.size(); i++) {
+            ReadOptions task_options = options;
+            task_options.stat = &stats[i];
+            auto task = [this, task_options, block = missed_blocks[i], mem_tracker, &latch]() {
+                SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+                block.second->reset(BlockReader(this, task_options, *block.first));
+                latch.count_down();
+            };
+            if (!options.prefetch_pool->submit_func(task).ok()) {
+                // the pool is shutting down, read the block in current thread.
+                task();
+            }
+        }
+        latch.wait();
+        if (options.stat != nullptr) {
+            for (const auto& stat : stats) {
+                options.stat->bytes_from_file += stat.bytes_from_file;
+                options.stat->bytes_from_cache += stat.bytes_from_cache;
+                options.stat->block_cnt_from_file += stat.block_cnt_from_file;
+                options.stat->block_cnt_from_cache += stat.block_cnt_from_cache;
+            }
+        }
+        TRACE_COUNTER_INCREMENT("sst_prefetch_block_cnt", missed_blocks.size());
+    }
+    for (const auto& [_, iter] : *iters) {
+        RETURN_IF_ERROR(iter->status());
+    }
+    return Status::OK();
+}
+
 template <class ForwardIt>
 Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt begin, ForwardIt end,
                        std::vector<std::string>* values) {
-    Status s;
-    Iterator* iiter = rep_->index_block->NewIterator(rep_->options.comparator);
-    std::unique_ptr<Iterator> current_block_itr_ptr;
-
     // return true if find k
     auto search_in_block = [](const Slice& k, std::string* value, Iterator* current_block_itr) -> StatusOr<bool> {
         current_block_itr->Seek(k);
@@ -253,57 +317,86 @@ Status Table::MultiGet(const ReadOptions& options, const Slice* keys, ForwardIt
         return false;
     };
 
-    int64_t continue_block_read_cnt = 0;
+    // 1. Locate the data block of each key by index block and filter, which are both in memory.
+    // The offset of block is -1 if the key can not be in this table.
+    int64_t t0 = butil::gettimeofday_us();
+    std::unique_ptr<Iterator> iiter(rep_->index_block->NewIterator(rep_->options.comparator));
+    std::vector<int64_t> block_offsets;
+    // block offset -> encoded block handle
+    std::map<uint64_t, std::string> block_handles;
     int64_t sst_bloom_filter_rows = 0;
-    int64_t multiget_t1_us = 0;
-    int64_t multiget_t2_us = 0;
-    int64_t multiget_t3_us = 0;
-    size_t i = 0;
-    bool founded = false;
-    for (auto it = begin; it != end; ++it, ++i) {
+    int64_t candidate_rows = 0;
+    for (auto it = begin; it != end; ++it) {
         auto& k = keys[*it];
-        int64_t t0 = butil::gettimeofday_us();
-        if (current_block_itr_ptr != nullptr && current_block_itr_ptr->Valid()) {
-            // keep searching current block
-            ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
-            if (founded) {
-                continue_block_read_cnt++;
+        iiter->Seek(k);
+        if (!iiter->Valid()) {
+            block_offsets.push_back(-1);
+            continue;
+        }
+        Slice handle_value = iiter->value();
+        Slice input = handle_value;
+        BlockHandle handle;
+        RETURN_IF_ERROR(handle.DecodeFrom(&input));
+        FilterBlockReader* filter = rep_->filter;
+        if (filter != nullptr && !filter->KeyMayMatch(handle.offset(), k)) {
+            // Not found
+            sst_bloom_filter_rows++;
+            block_offsets.push_back(-1);
+            continue;
+        }
+        block_offsets.push_back(handle.offset());
+        block_handles.emplace(handle.offset(), handle_value.to_string());
+        candidate_rows++;
+    }
+    RETURN_IF_ERROR(iiter->status());
+
+    // 2. Split keys into windows that need at most max_multi_get_blocks data blocks. For each window, read
+    // its data blocks, so that the blocks missed in block cache can be fetched concurrently rather than one
+    // by one, then search the keys of the window in their blocks.
+    int64_t t1 = butil::gettimeofday_us();
+    int64_t read_us = 0;
+    const size_t max_window_blocks = std::max<size_t>(options.max_multi_get_blocks, 1);
+    std::map<uint64_t, std::string> window_handles;
+    std::map<uint64_t, std::unique_ptr<Iterator>> block_iters;
+    ForwardIt window_begin = begin;
+    size_t window_begin_idx = 0;
+    auto search_window = [&](ForwardIt window_end) -> Status {
+        int64_t read_start = butil::gettimeofday_us();
+        RETURN_IF_ERROR(ReadBlocks(options, window_handles, &block_iters));
+        read_us += butil::gettimeofday_us() - read_start;
+        size_t i = window_begin_idx;
+        for (auto it = window_begin; it != window_end; ++it, ++i) {
+            if (block_offsets[i] < 0) {
                 continue;
-            } else {
-                current_block_itr_ptr.reset(nullptr);
             }
+            auto* block_iter = block_iters[block_offsets[i]].get();
+            RETURN_IF_ERROR(search_in_block(keys[*it], &(*values)[i], block_iter).status());
         }
-        int64_t t1 = butil::gettimeofday_us();
-        iiter->Seek(k);
-        int64_t t2 = butil::gettimeofday_us();
-        if (iiter->Valid()) {
-            Slice handle_value = iiter->value();
-            FilterBlockReader* filter = rep_->filter;
-            BlockHandle handle;
-            if (filter != nullptr && handle.DecodeFrom(&handle_value).ok() &&
-                !filter->KeyMayMatch(handle.offset(), k)) {
-                // Not found
-                sst_bloom_filter_rows++;
-            } else {
-                current_block_itr_ptr.reset(BlockReader(this, options, iiter->value()));
-                ASSIGN_OR_RETURN(founded, search_in_block(k, &(*values)[i], current_block_itr_ptr.get()));
-            }
+        window_handles.clear();
+        block_iters.clear();
+        return Status::OK();
+    };
+    size_t i = 0;
+    for (auto it = begin; it != end; ++it, ++i) {
+        if (block_offsets[i] < 0) {
+            continue;
         }
-        int64_t t3 = butil::gettimeofday_us();
-        multiget_t1_us += t1 - t0;
-        multiget_t2_us += t2 - t1;
-        multiget_t3_us += t3 - t2;
-    }
-    if (s.ok()) {
-        s = iiter->status();
+        if (window_handles.size() >= max_window_blocks && !window_handles.contains(block_offsets[i])) {
+            RETURN_IF_ERROR(search_window(it));
+            window_begin = it;
+            window_begin_idx = i;
+        }
+        window_handles.emplace(block_offsets[i], block_handles[block_offsets[i]]);
     }
-    delete iiter;
-    TRACE_COUNTER_INCREMENT("continue_block_read_cnt", continue_block_read_cnt);
+    RETURN_IF_ERROR(search_window(end));
+    int64_t t2 = butil::gettimeofday_us();
+    // number of keys that reuse a data block read by other keys in the batch
+    TRACE_COUNTER_INCREMENT("continue_block_read_cnt", candidate_rows - block_handles.size());
     TRACE_COUNTER_INCREMENT("sst_bloom_filter_rows", sst_bloom_filter_rows);
-    TRACE_COUNTER_INCREMENT("multiget_t1_us", multiget_t1_us);
-    TRACE_COUNTER_INCREMENT("multiget_t2_us", multiget_t2_us);
-    TRACE_COUNTER_INCREMENT("multiget_t3_us", multiget_t3_us);
-    return s;
+    TRACE_COUNTER_INCREMENT("multiget_t1_us", t1 - t0);
+    TRACE_COUNTER_INCREMENT("multiget_t2_us", read_us);
+    TRACE_COUNTER_INCREMENT("multiget_t3_us", t2 - t1 - read_us);
+    return Status::OK();
 }
 
 size_t Table::memory_usage() const {
@@ -3,6 +3,11 @@
 // (https://developers.google.com/open-source/licenses/bsd)
 #pragma once
 
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "common/status.h"
 
 namespace starrocks {
@@ -45,6 +50,10 @@ public:
     // call one of the Seek methods on the iterator before using it).
     Iterator* NewIterator(const ReadOptions&) const;
 
+    // Returns a new iterator over the index block. Each entry maps a key that is >= the
+    // last key of a data block (and < the first key of the next one) to that block's handle.
+    Iterator* NewIndexIterator() const;
+
     // Batch get keys within indexes iterator between begin to end.
     // If entry found, value of the corresponding index will be set.
     template <typename ForwardIt>
@@ -58,6 +67,13 @@ private:
 
     static Iterator* BlockReader(void*, const ReadOptions&, const Slice&);
 
+    // Open iterators of the data blocks in |handles|, which maps block offset to encoded
+    // block handle. Blocks absent from block cache are read concurrently if
+    // ReadOptions::prefetch_pool is set.
+    Status ReadBlocks(const ReadOptions& options, const std::map<uint64_t, std::string>& handles,
+                      std::map<uint64_t, std::unique_ptr<Iterator>>* iters);
+    bool BlockInCache(uint64_t offset) const;
+
     explicit Table(Rep* rep) : rep_(rep) {}
 
     void ReadMeta(const Footer& footer);
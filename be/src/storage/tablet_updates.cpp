@@ -378,6 +378,9 @@ Status TabletUpdates::_load_from_pb(const TabletUpdatesPB& tablet_updates_pb) {
     StorageEngine::instance()->update_manager()->clear_cached_del_vec(tsids_vec);
     StorageEngine::instance()->update_manager()->clear_cached_delta_column_group(tsids_vec);
     StorageEngine::instance()->update_manager()->index_cache().try_remove_by_key(_tablet.tablet_id());
+    if (auto* row_cache = StorageEngine::instance()->update_manager()->pk_row_cache(); row_cache != nullptr) {
+        row_cache->invalidate(_tablet.tablet_id());
+    }
 
     _update_total_stats(_edit_version_infos[_apply_version_idx]->rowsets, nullptr, nullptr);
     VLOG(2) << "load tablet " << _debug_string(false, true);
@@ -1147,6 +1150,16 @@ Status TabletUpdates::_apply_column_partial_update_commit(const EditVersionInfo&
     }
 
     std::lock_guard lg(_index_lock);
+    // Updated keys are not collected in column mode, all the cached rows of the tablet are dropped.
+    auto* row_cache = _tablet.is_column_with_row_store() ? manager->pk_row_cache() : nullptr;
+    if (row_cache != nullptr) {
+        row_cache->begin_apply(tablet_id);
+    }
+    DeferOp row_cache_defer([&]() {
+        if (row_cache != nullptr) {
+            row_cache->end_apply(tablet_id, -1);
+        }
+    });
     // 2. load primary index, using it in finalize step.
     auto index_entry = manager->index_cache().get_or_create(tablet_id);
     index_entry->update_expire_time(MonotonicMillis() + manager->get_index_cache_expire_ms(_tablet));
@@ -1365,6 +1378,22 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
     }
 
     std::lock_guard lg(_index_lock);
+    // The cached rows of short circuit point lookups are erased when the keys are upserted or deleted, and no
+    // row can be cached until the apply is finished.
+    auto* row_cache = _tablet.is_column_with_row_store() ? manager->pk_row_cache() : nullptr;
+    if (row_cache != nullptr) {
+        row_cache->begin_apply(tablet_id);
+    }
+    DeferOp row_cache_defer([&]() {
+        if (row_cache != nullptr) {
+            row_cache->end_apply(tablet_id, apply_st.ok() ? version.major_number() : -1);
+        }
+    });
+    auto erase_cached_rows = [&](const Column& pks) {
+        if (row_cache != nullptr) {
+            row_cache->erase(tablet_id, pks);
+        }
+    };
     // 2. load index
     auto index_entry = manager->index_cache().get_or_create(tablet_id);
     index_entry->update_expire_time(MonotonicMillis() + manager->get_index_cache_expire_ms(_tablet));
@@ -1471,6 +1500,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                     failure_handler(msg, st.code(), true);
                     return apply_st;
                 }
+                erase_cached_rows(*upserts[i]);
                 st = _do_update(rowset_id, i, conditional_column, latest_applied_version.major_number(), upserts, index,
                                 tablet_id, &new_deletes, apply_tschema);
                 if (!st.ok()) {
@@ -1482,6 +1512,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                 }
                 manager->index_cache().update_object_size(index_entry, index.memory_usage());
                 if (delete_pks != nullptr) {
+                    erase_cached_rows(*delete_pks);
                     st = index.erase(*delete_pks, &new_deletes);
                     if (!st.ok()) {
                         std::string msg = strings::Substitute("_apply_rowset_commit error: index erase failed: $0 $1",
@@ -1507,6 +1538,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
             }
             auto& deletes = state.deletes();
             delete_op += deletes[i]->size();
+            erase_cached_rows(*deletes[i]);
             st = index.erase(*deletes[i], &new_deletes);
             if (!st.ok()) {
                 std::string msg = strings::Substitute("_apply_rowset_commit error: index erase failed: $0 $1",
@@ -1556,6 +1588,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                         failure_handler(msg, st.code(), true);
                         return apply_st;
                     }
+                    erase_cached_rows(*upserts[loaded_upsert]);
                     st = _do_update(rowset_id, loaded_upsert, conditional_column, latest_applied_version.major_number(),
                                     upserts, index, tablet_id, &new_deletes, apply_tschema);
                     FAIL_POINT_TRIGGER_EXECUTE(tablet_apply_index_upsert_failed, {
@@ -1570,6 +1603,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                     }
                     manager->index_cache().update_object_size(index_entry, index.memory_usage());
                     if (delete_pks != nullptr) {
+                        erase_cached_rows(*delete_pks);
                         st = index.erase(*delete_pks, &new_deletes);
                         if (!st.ok()) {
                             std::string msg =
@@ -1597,6 +1631,7 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                 }
                 auto& deletes = state.deletes();
                 delete_op += deletes[loaded_delfile]->size();
+                erase_cached_rows(*deletes[loaded_delfile]);
                 st = index.erase(*deletes[loaded_delfile], &new_deletes);
                 FAIL_POINT_TRIGGER_EXECUTE(tablet_apply_index_delete_failed,
                                            { st = Status::InternalError("inject tablet_apply_index_delete_failed"); });
@@ -5238,6 +5273,9 @@ Status TabletUpdates::clear_meta() {
     // There maybe other thread still use primary index for example ingestion and schema change concurrently
     // If that, the primary index will be release by evict thread.
     StorageEngine::instance()->update_manager()->index_cache().try_remove_by_key(_tablet.tablet_id());
+    if (auto* row_cache = StorageEngine::instance()->update_manager()->pk_row_cache(); row_cache != nullptr) {
+        row_cache->invalidate(_tablet.tablet_id());
+    }
     STLClearObject(&_rowsets);
     STLClearObject(&_rowset_stats);
     // If this get cleared, every other thread that uses variable should recheck it's valid state after acquiring _lock
@@ -77,10 +77,18 @@ UpdateManager::UpdateManager(MemTracker* mem_tracker)
     int32_t update_mem_percent = std::max(std::min(100, config::update_memory_limit_percent), 0);
     _index_cache.set_capacity(byte_limits * update_mem_percent / 100);
     _update_column_state_cache.set_mem_tracker(_update_state_mem_tracker.get());
+
+    if (config::pk_row_cache_capacity > 0) {
+        _pk_row_cache_mem_tracker = std::make_unique<MemTracker>(-1, "pk_row_cache", mem_tracker);
+        _pk_row_cache =
+                std::make_unique<PrimaryKeyRowCache>(config::pk_row_cache_capacity, _pk_row_cache_mem_tracker.get());
+    }
 }
 
 UpdateManager::~UpdateManager() {
     clear_cache();
+    _pk_row_cache.reset();
+    _pk_row_cache_mem_tracker.reset();
     if (_compaction_state_mem_tracker) {
         _compaction_state_mem_tracker.reset();
     }
@@ -414,9 +422,16 @@ void UpdateManager::expire_cache() {
                 _del_vec_cache.cbegin(), _del_vec_cache.cend(), 0,
                 [](const int& accumulated, const auto& p) { return accumulated + p.second->memory_usage(); }));
     }
+    if (_pk_row_cache != nullptr) {
+        StarRocksMetrics::instance()->update_pk_row_cache_bytes_total.set_value(_pk_row_cache->memory_usage());
+        StarRocksMetrics::instance()->update_pk_row_cache_tablet_num.set_value(_pk_row_cache->num_states());
+    }
     if (MonotonicMillis() - _last_clear_expired_cache_millis > _cache_expire_ms) {
         _update_state_cache.clear_expired();
         _update_column_state_cache.clear_expired();
+        if (_pk_row_cache != nullptr) {
+            _pk_row_cache->prune_states(_cache_expire_ms);
+        }
 
         ssize_t orig_size = _index_cache.size();
         ssize_t orig_obj_size = _index_cache.object_size();
@@ -21,6 +21,7 @@
 #include "storage/delta_column_group.h"
 #include "storage/olap_common.h"
 #include "storage/primary_index.h"
+#include "storage/primary_key_row_cache.h"
 #include "util/dynamic_cache.h"
 #include "util/mem_info.h"
 #include "util/parse_util.h"
@@ -105,6 +106,9 @@ public:
 
     DynamicCache<string, RowsetColumnUpdateState>& update_column_state_cache() { return _update_column_state_cache; }
 
+    // nullptr if row cache is disabled
+    PrimaryKeyRowCache* pk_row_cache() { return _pk_row_cache.get(); }
+
     Status get_delta_column_group(KVStore* meta, const TabletSegmentId& tsid, int64_t version,
                                   DeltaColumnGroupList* dcgs);
 
@@ -170,6 +174,9 @@ private:
 
     std::unique_ptr<MemTracker> _compaction_state_mem_tracker;
 
+    std::unique_ptr<MemTracker> _pk_row_cache_mem_tracker;
+    std::unique_ptr<PrimaryKeyRowCache> _pk_row_cache;
+
     std::atomic<int64_t> _last_clear_expired_cache_millis{0};
 
     // DelVector related states
@@ -143,6 +143,10 @@ public:
     // longer needed.
     virtual Handle* lookup(const CacheKey& key) = 0;
 
+    // Return true if the cache has a mapping for "key". Unlike lookup(), it neither counts as a lookup in the
+    // statistics nor changes the LRU order of the entry.
+    virtual bool contains(const CacheKey& key) = 0;
+
     // Release a mapping returned by a previous Lookup().
     // REQUIRES: handle must not have been released yet.
     // REQUIRES: handle must have been returned by a method on *this.
@@ -272,6 +276,7 @@ public:
                           void (*deleter)(const CacheKey& key, void* value),
                           CachePriority priority = CachePriority::NORMAL);
     Cache::Handle* lookup(const CacheKey& key, uint32_t hash);
+    bool contains(const CacheKey& key, uint32_t hash);
     void release(Cache::Handle* handle);
     void erase(const CacheKey& key, uint32_t hash);
     int prune();
@@ -318,6 +323,7 @@ public:
                    void (*deleter)(const CacheKey& key, void* value),
                    CachePriority priority = CachePriority::NORMAL) override;
     Handle* lookup(const CacheKey& key) override;
+    bool contains(const CacheKey& key) override;
     void release(Handle* handle) override;
     void erase(const CacheKey& key) override;
     void* value(Handle* handle) override;
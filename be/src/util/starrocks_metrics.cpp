@@ -101,6 +101,8 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name), _table_metric
     REGISTER_STARROCKS_METRIC(update_del_vector_num);
     REGISTER_STARROCKS_METRIC(update_del_vector_dels_num);
     REGISTER_STARROCKS_METRIC(update_del_vector_bytes_total);
+    REGISTER_STARROCKS_METRIC(update_pk_row_cache_bytes_total);
+    REGISTER_STARROCKS_METRIC(update_pk_row_cache_tablet_num);
     REGISTER_STARROCKS_METRIC(update_del_vector_deletes_total);
     REGISTER_STARROCKS_METRIC(update_del_vector_deletes_new);
     REGISTER_STARROCKS_METRIC(column_partial_update_apply_total);
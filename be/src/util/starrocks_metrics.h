@@ -272,6 +272,8 @@ public:
     METRIC_DEFINE_UINT_GAUGE(update_del_vector_num, MetricUnit::OPERATIONS);
     METRIC_DEFINE_UINT_GAUGE(update_del_vector_dels_num, MetricUnit::OPERATIONS);
     METRIC_DEFINE_UINT_GAUGE(update_del_vector_bytes_total, MetricUnit::BYTES);
+    METRIC_DEFINE_UINT_GAUGE(update_pk_row_cache_bytes_total, MetricUnit::BYTES);
+    METRIC_DEFINE_UINT_GAUGE(update_pk_row_cache_tablet_num, MetricUnit::OPERATIONS);
     METRIC_DEFINE_UINT_COUNTER(update_del_vector_deletes_total, MetricUnit::NOUNIT);
     METRIC_DEFINE_UINT_COUNTER(update_del_vector_deletes_new, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_COUNTER(column_partial_update_apply_total, MetricUnit::REQUESTS);
@@ -126,6 +126,10 @@ public:
     METRIC_DEFINE_INT_GAUGE(query_cache_lookup_count, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(query_cache_hit_count, MetricUnit::NOUNIT);
     METRIC_DEFINE_DOUBLE_GAUGE(query_cache_hit_ratio, MetricUnit::PERCENT);
+    METRIC_DEFINE_INT_GAUGE(query_cache_disk_capacity, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_GAUGE(query_cache_disk_usage, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_GAUGE(query_cache_disk_lookup_count, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_GAUGE(query_cache_disk_hit_count, MetricUnit::NOUNIT);
 };
 
 class VectorIndexCacheMetrics {
@@ -672,6 +676,10 @@ void SystemMetrics::_update_query_cache_metrics() {
     _query_cache_metrics->query_cache_lookup_count.set_value(lookup_count);
     _query_cache_metrics->query_cache_hit_count.set_value(hit_count);
     _query_cache_metrics->query_cache_hit_ratio.set_value(hit_ratio);
+    _query_cache_metrics->query_cache_disk_capacity.set_value(cache_mgr->disk_capacity());
+    _query_cache_metrics->query_cache_disk_usage.set_value(cache_mgr->disk_usage());
+    _query_cache_metrics->query_cache_disk_lookup_count.set_value(cache_mgr->disk_lookup_count());
+    _query_cache_metrics->query_cache_disk_hit_count.set_value(cache_mgr->disk_hit_count());
 }
 
 void SystemMetrics::_install_vector_index_cache_metrics(MetricRegistry* registry) {
@@ -743,6 +751,10 @@ void SystemMetrics::_install_query_cache_metrics(starrocks::MetricRegistry* regi
     registry->register_metric("query_cache_lookup_count", &_query_cache_metrics->query_cache_lookup_count);
     registry->register_metric("query_cache_hit_count", &_query_cache_metrics->query_cache_hit_count);
     registry->register_metric("query_cache_hit_ratio", &_query_cache_metrics->query_cache_hit_ratio);
+    registry->register_metric("query_cache_disk_capacity", &_query_cache_metrics->query_cache_disk_capacity);
+    registry->register_metric("query_cache_disk_usage", &_query_cache_metrics->query_cache_disk_usage);
+    registry->register_metric("query_cache_disk_lookup_count", &_query_cache_metrics->query_cache_disk_lookup_count);
+    registry->register_metric("query_cache_disk_hit_count", &_query_cache_metrics->query_cache_disk_hit_count);
 }
 
 void SystemMetrics::_install_runtime_filter_metrics(starrocks::MetricRegistry* registry) {
@@ -755,6 +767,12 @@ void SystemMetrics::_install_runtime_filter_metrics(starrocks::MetricRegistry* r
         REGISTER_RUNTIME_FILTER_METRIC(runtime_filter_bytes_in_queue);
         _runtime_filter_metrics.emplace(type, metrics);
     }
+    registry->register_metric("runtime_filter_merge_latency_ns", &_runtime_filter_merge_latency_ns);
+    registry->register_metric("runtime_filter_merge_bytes", &_runtime_filter_merge_bytes);
+    registry->register_metric("runtime_filter_broadcast_tree_bytes", MetricLabels().add("role", "root"),
+                              &_runtime_filter_broadcast_root_bytes);
+    registry->register_metric("runtime_filter_broadcast_tree_bytes", MetricLabels().add("role", "forward"),
+                              &_runtime_filter_broadcast_forward_bytes);
 }
 
 void SystemMetrics::_update_runtime_filter_metrics() {
@@ -772,6 +790,10 @@ void SystemMetrics::_update_runtime_filter_metrics() {
         iter->second->runtime_filter_events_in_queue.set_value(metrics->event_nums[i]);
         iter->second->runtime_filter_bytes_in_queue.set_value(metrics->runtime_filter_bytes[i]);
     }
+    _runtime_filter_merge_latency_ns.set_value(metrics->merge_latency_ns);
+    _runtime_filter_merge_bytes.set_value(metrics->merge_bytes);
+    _runtime_filter_broadcast_root_bytes.set_value(metrics->broadcast_tree_root_bytes);
+    _runtime_filter_broadcast_forward_bytes.set_value(metrics->broadcast_tree_forward_bytes);
 }
 
 void SystemMetrics::_update_fd_metrics() {
@@ -153,6 +153,10 @@ private:
     std::unique_ptr<QueryCacheMetrics> _query_cache_metrics;
     std::unique_ptr<VectorIndexCacheMetrics> _vector_index_cache_metrics;
     std::map<std::string, RuntimeFilterMetrics*> _runtime_filter_metrics;
+    IntGauge _runtime_filter_merge_latency_ns{MetricUnit::NANOSECONDS};
+    IntGauge _runtime_filter_merge_bytes{MetricUnit::BYTES};
+    IntGauge _runtime_filter_broadcast_root_bytes{MetricUnit::BYTES};
+    IntGauge _runtime_filter_broadcast_forward_bytes{MetricUnit::BYTES};
     int _proc_net_dev_version = 0;
     std::unique_ptr<SnmpMetrics> _snmp_metrics;
     std::vector<IOMetrics*> _io_metrics;
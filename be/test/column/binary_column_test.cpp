@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <utility>
+
 #include "column/column_helper.h"
 #include "column/const_column.h"
 #include "column/fixed_length_column.h"
@@ -669,4 +671,64 @@ PARALLEL_TEST(BinaryColumnTest, test_reference_memory_usage) {
     ASSERT_EQ(0, column->Column::reference_memory_usage());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(BinaryColumnTest, test_is_ascii) {
+    BinaryColumn::Ptr column = BinaryColumn::create();
+    ASSERT_TRUE(column->is_ascii());
+    column->append("abc");
+    column->append("de");
+    ASSERT_TRUE(column->is_ascii());
+    ASSERT_EQ(5, column->_ascii_checked_bytes);
+
+    // only the appended bytes are scanned
+    column->append("f");
+    ASSERT_TRUE(column->is_ascii());
+    ASSERT_EQ(6, column->_ascii_checked_bytes);
+    column->append("中文");
+    ASSERT_FALSE(column->is_ascii());
+
+    // the non-ascii row is filtered out
+    Filter filter{1, 1, 1, 0};
+    column->filter(filter);
+    ASSERT_EQ(3, column->size());
+    ASSERT_TRUE(column->is_ascii());
+
+    // rewriting the bytes drops the cached result
+    column->get_bytes()[0] = 0xE4;
+    ASSERT_FALSE(column->is_ascii());
+    column->get_bytes()[0] = 'a';
+    ASSERT_TRUE(column->is_ascii());
+
+    // the known result is kept by copying and appending ascii columns
+    auto copy = column->clone();
+    auto* binary_copy = down_cast<BinaryColumn*>(copy.get());
+    // the non-const get_bytes() would drop the cache
+    ASSERT_EQ(std::as_const(*binary_copy).get_bytes().size(), column->_ascii_checked_bytes);
+    binary_copy->append(*column, 0, 2);
+    ASSERT_TRUE(binary_copy->_known_ascii());
+    ASSERT_TRUE(binary_copy->is_ascii());
+
+    auto cut = column->cut(1, 2);
+    ASSERT_TRUE(down_cast<const BinaryColumn*>(cut.get())->_known_ascii());
+
+    BinaryColumn::Ptr utf8 = BinaryColumn::create();
+    utf8->append("中文");
+    ASSERT_FALSE(utf8->is_ascii());
+    binary_copy->append(*utf8, 0, 1);
+    ASSERT_FALSE(binary_copy->is_ascii());
+
+    column->reset_column();
+    ASSERT_TRUE(column->is_ascii());
+
+    // the compacted bytes are checked again, the unchecked non-ascii row moves into the checked prefix
+    column->append("abc");
+    column->append("def");
+    ASSERT_TRUE(column->is_ascii());
+    column->append("中");
+    Filter filter2{0, 1, 1};
+    column->filter(filter2);
+    ASSERT_EQ(2, column->size());
+    ASSERT_FALSE(column->is_ascii());
+}
+
 } // namespace starrocks
@@ -0,0 +1,159 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "connector/spillable_partition_buffer.h"
+
+#include <fmt/format.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/spill/dir_manager.h"
+#include "exec/spill/log_block_manager.h"
+#include "fs/fs.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/uid_util.h"
+
+namespace starrocks::connector {
+namespace {
+
+class SpillablePartitionBufferTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _query_id = generate_uuid();
+        auto path = fmt::format("{}/{}", config::storage_root_path, "connector_sink_spill");
+        auto fs = FileSystem::Default();
+        ASSERT_OK(fs->create_dir_recursive(path));
+        auto dir = std::make_shared<spill::Dir>(path, FileSystem::CreateSharedFromString(path).value(), INT64_MAX);
+        _dir_mgr = std::make_unique<spill::DirManager>(std::vector<spill::DirPtr>{dir});
+        _block_mgr = std::make_unique<spill::LogBlockManager>(_query_id, _dir_mgr.get());
+        ASSERT_OK(_block_mgr->open());
+    }
+
+    static ChunkPtr make_chunk(const std::vector<int32_t>& values) {
+        auto column = Int32Column::create();
+        for (int32_t v : values) {
+            column->append(v);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), 1);
+        return chunk;
+    }
+
+    static std::vector<int32_t> drain(SpillablePartitionBuffer* buffer, const std::string& partition) {
+        std::vector<int32_t> values;
+        auto st = buffer->drain(partition, [&](Chunk* chunk) {
+            auto column = chunk->get_column_by_slot_id(1);
+            for (size_t i = 0; i < column->size(); i++) {
+                values.emplace_back(column->get(i).get_int32());
+            }
+            return Status::OK();
+        });
+        EXPECT_OK(st);
+        return values;
+    }
+
+    TUniqueId _query_id;
+    std::unique_ptr<spill::DirManager> _dir_mgr;
+    std::unique_ptr<spill::LogBlockManager> _block_mgr;
+    RuntimeState _state;
+};
+
+TEST_F(SpillablePartitionBufferTest, test_spill_and_drain) {
+    SpillablePartitionBuffer buffer(&_state, _block_mgr.get(), nullptr);
+
+    ASSERT_TRUE(buffer.append("k=1/", *make_chunk({1, 2, 3})).value());
+    ASSERT_TRUE(buffer.append("k=2/", *make_chunk({10, 20})).value());
+    ASSERT_TRUE(buffer.append("k=1/", *make_chunk({4, 5, 6, 7})).value());
+    EXPECT_GT(buffer.buffered_bytes(), 0);
+    EXPECT_EQ(0, buffer.spilled_bytes());
+    EXPECT_TRUE(buffer.contains("k=2/"));
+    EXPECT_FALSE(buffer.contains("k=3/"));
+
+    // k=1/ buffers the most bytes, the spill runs in place without a workgroup
+    ASSERT_EQ("k=1/", buffer.largest_partition());
+    ASSERT_OK(buffer.spill_async("k=1/"));
+    ASSERT_FALSE(buffer.has_pending_task());
+    ASSERT_OK(buffer.task_status());
+    ASSERT_FALSE(buffer.spill_failed());
+    EXPECT_GT(buffer.spilled_bytes(), 0);
+    EXPECT_EQ(0, buffer.spilling_bytes());
+    ASSERT_EQ("k=2/", buffer.largest_partition());
+    ASSERT_TRUE(buffer.append("k=1/", *make_chunk({8})).value());
+
+    auto partitions = buffer.partitions();
+    std::sort(partitions.begin(), partitions.end());
+    ASSERT_EQ((std::vector<std::string>{"k=1/", "k=2/"}), partitions);
+
+    // spilled rows come first
+    EXPECT_EQ((std::vector<int32_t>{1, 2, 3, 4, 5, 6, 7, 8}), drain(&buffer, "k=1/"));
+    EXPECT_EQ((std::vector<int32_t>{10, 20}), drain(&buffer, "k=2/"));
+    EXPECT_TRUE(buffer.partitions().empty());
+    EXPECT_EQ(0, buffer.buffered_bytes());
+    EXPECT_EQ("", buffer.largest_partition());
+}
+
+TEST_F(SpillablePartitionBufferTest, test_spill_failed) {
+    // a spill dir without any capacity
+    auto path = fmt::format("{}/{}", config::storage_root_path, "connector_sink_spill_full");
+    ASSERT_OK(FileSystem::Default()->create_dir_recursive(path));
+    auto dir = std::make_shared<spill::Dir>(path, FileSystem::CreateSharedFromString(path).value(), 0);
+    spill::DirManager dir_mgr(std::vector<spill::DirPtr>{dir});
+    spill::LogBlockManager block_mgr(_query_id, &dir_mgr);
+    ASSERT_OK(block_mgr.open());
+
+    SpillablePartitionBuffer buffer(&_state, &block_mgr, nullptr);
+    ASSERT_TRUE(buffer.append("k=1/", *make_chunk({1, 2, 3})).value());
+    int64_t buffered_bytes = buffer.buffered_bytes();
+    ASSERT_OK(buffer.spill_async("k=1/"));
+    ASSERT_FALSE(buffer.has_pending_task());
+    // the rows are kept in memory and the sink falls back to writing them out
+    ASSERT_TRUE(buffer.spill_failed());
+    ASSERT_OK(buffer.task_status());
+    EXPECT_EQ(buffered_bytes, buffer.buffered_bytes());
+    EXPECT_EQ(0, buffer.spilling_bytes());
+    EXPECT_EQ(0, buffer.spilled_bytes());
+    EXPECT_EQ((std::vector<int32_t>{1, 2, 3}), drain(&buffer, "k=1/"));
+}
+
+TEST_F(SpillablePartitionBufferTest, test_task_status) {
+    SpillablePartitionBuffer buffer(&_state, _block_mgr.get(), nullptr);
+
+    ASSERT_OK(buffer.submit_task([] { return Status::OK(); }));
+    ASSERT_OK(buffer.task_status());
+    ASSERT_OK(buffer.submit_task([] { return Status::InternalError("write failed"); }));
+    ASSERT_FALSE(buffer.has_pending_task());
+    // the first error is kept
+    ASSERT_OK(buffer.submit_task([] { return Status::Cancelled("cancelled"); }));
+    ASSERT_TRUE(buffer.task_status().is_internal_error());
+}
+
+TEST_F(SpillablePartitionBufferTest, test_append_incompatible_chunk) {
+    SpillablePartitionBuffer buffer(&_state, _block_mgr.get(), nullptr);
+
+    ASSERT_TRUE(buffer.append("k=1/", *make_chunk({1, 2})).value());
+    // a const null column loses its type, the caller writes such chunks directly
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(ColumnHelper::create_const_null_column(2), 1);
+    ASSERT_FALSE(buffer.append("k=1/", *chunk).value());
+    EXPECT_EQ((std::vector<int32_t>{1, 2}), drain(&buffer, "k=1/"));
+}
+
+} // namespace
+} // namespace starrocks::connector
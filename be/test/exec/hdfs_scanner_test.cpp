@@ -20,6 +20,7 @@
 
 #include "cache/block_cache/block_cache.h"
 #include "cache/block_cache/test_cache_utils.h"
+#include "cache/object_cache/starcache_module.h"
 #include "cache/starcache_wrapper.h"
 #include "column/column_helper.h"
 #include "exec/hdfs_scanner_orc.h"
@@ -32,6 +33,7 @@
 #include "runtime/runtime_state.h"
 #include "storage/chunk_helper.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -436,6 +438,65 @@ TEST_F(HdfsScannerTest, TestOrcGetNext) {
     scanner->close();
 }
 
+TEST_F(HdfsScannerTest, TestOrcFileTailCache) {
+    CacheOptions options = TestCacheUtils::create_simple_options(256 * KB, 100 * MB);
+    auto local_cache = std::make_shared<StarCacheWrapper>();
+    ASSERT_OK(local_cache->init(options));
+    auto cache = std::make_shared<StarCacheModule>(local_cache->starcache_instance());
+
+    auto scanner = std::make_shared<HdfsOrcScanner>();
+    ASSERT_EQ(nullptr, scanner->lookup_file_tail_cache(cache.get(), "tail_key"));
+
+    scanner->insert_file_tail_cache(cache.get(), "tail_key", std::make_shared<std::string>("orc file tail"));
+    ASSERT_EQ(1, scanner->_app_stats.footer_cache_write_count);
+    ASSERT_EQ(13, scanner->_app_stats.footer_cache_write_bytes);
+
+    auto file_tail = scanner->lookup_file_tail_cache(cache.get(), "tail_key");
+    ASSERT_NE(nullptr, file_tail);
+    ASSERT_EQ("orc file tail", *file_tail);
+    ASSERT_EQ(1, scanner->_app_stats.footer_cache_read_count);
+    ASSERT_EQ(nullptr, scanner->lookup_file_tail_cache(cache.get(), "other_key"));
+}
+
+TEST_F(HdfsScannerTest, TestOrcFileTailCacheHit) {
+    CacheOptions options = TestCacheUtils::create_simple_options(256 * KB, 100 * MB);
+    auto local_cache = std::make_shared<StarCacheWrapper>();
+    ASSERT_OK(local_cache->init(options));
+    auto* cache_env = CacheEnv::GetInstance();
+    auto old_meta_cache = cache_env->_starcache_based_object_cache;
+    cache_env->_starcache_based_object_cache = std::make_shared<StarCacheModule>(local_cache->starcache_instance());
+    DeferOp defer([&]() { cache_env->_starcache_based_object_cache = old_meta_cache; });
+
+    auto open_and_read = [&]() {
+        auto scanner = std::make_shared<HdfsOrcScanner>();
+        auto* range = _create_scan_range(mtypes_orc_file, 0, 0);
+        auto* tuple_desc = _create_tuple_desc(mtypes_orc_descs);
+        auto* param = _create_param(mtypes_orc_file, range, tuple_desc);
+        param->use_file_metacache = true;
+        // partition values for [PART_x, PART_y]
+        std::vector<int64_t> values = {10, 20};
+        extend_partition_values(&_pool, param, values);
+        EXPECT_OK(Expr::prepare(param->partition_values, _runtime_state));
+        EXPECT_OK(Expr::open(param->partition_values, _runtime_state));
+
+        EXPECT_OK(scanner->init(_runtime_state, *param));
+        EXPECT_OK(scanner->open(_runtime_state));
+        READ_SCANNER_ROWS(scanner, 100);
+        scanner->close();
+        return scanner;
+    };
+
+    // the file tail is read from the file and cached by the first scan
+    auto scanner1 = open_and_read();
+    ASSERT_EQ(0, scanner1->_app_stats.footer_cache_read_count);
+    ASSERT_EQ(1, scanner1->_app_stats.footer_cache_write_count);
+
+    // and is read from the cache by the second scan
+    auto scanner2 = open_and_read();
+    ASSERT_EQ(1, scanner2->_app_stats.footer_cache_read_count);
+    ASSERT_EQ(0, scanner2->_app_stats.footer_cache_write_count);
+}
+
 TEST_F(HdfsScannerTest, TestOrcSkipFile) {
     auto scanner = std::make_shared<HdfsOrcScanner>();
 
@@ -1562,4 +1562,37 @@ TEST_F(JsonScannerTest, test_duplicate_key) {
     EXPECT_EQ("[2, 2]", chunk->debug_row(1));
 }
 
+TEST_F(JsonScannerTest, test_optional_and_reordered_keys) {
+    std::vector<TypeDescriptor> types;
+    types.emplace_back(TYPE_INT);
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+    types.emplace_back(TYPE_DOUBLE);
+    types.emplace_back(TypeDescriptor::create_varchar_type(20));
+
+    std::vector<TBrokerRangeDesc> ranges;
+    TBrokerRangeDesc range;
+    range.format_type = TFileFormatType::FORMAT_JSON;
+    range.file_type = TFileType::FILE_LOCAL;
+    range.__isset.strip_outer_array = false;
+    range.__isset.jsonpaths = false;
+    range.__isset.json_root = false;
+    range.__set_path("./be/test/exec/test_data/json_scanner/test_optional_keys.json");
+    ranges.emplace_back(range);
+
+    auto scanner = create_json_scanner(types, ranges, {"k1", "k2", "k3", "k4"});
+
+    Status st = scanner->open();
+    ASSERT_TRUE(st.ok());
+
+    ChunkPtr chunk = scanner->get_next().value();
+    EXPECT_EQ(4, chunk->num_columns());
+    EXPECT_EQ(5, chunk->num_rows());
+
+    EXPECT_EQ("[1, 'a', 1.5, 'x']", chunk->debug_row(0));
+    EXPECT_EQ("[2, NULL, 2.5, NULL]", chunk->debug_row(1));
+    EXPECT_EQ("[3, 'c', NULL, 'z']", chunk->debug_row(2));
+    EXPECT_EQ("[4, 'd', 4.5, 'w']", chunk->debug_row(3));
+    EXPECT_EQ("[5, 'e', 5.5, 'v']", chunk->debug_row(4));
+}
+
 } // namespace starrocks
@@ -0,0 +1,148 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/query_cache/cache_manager.h"
+#include "exec/query_cache/cache_operator.h"
+#include "exec/query_cache/cache_param.h"
+#include "storage/tablet_updates_test.h"
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+// Covers the incremental refresh of the cache entries of PRIMARY_KEYS tablets: a cache entry at version 2 is
+// probed at version 3, it is reused only if the delta rowset in version 3 appends new keys.
+class PkQueryCacheTest : public TabletUpdatesTest {
+public:
+    void SetUp() override {
+        TabletUpdatesTest::SetUp();
+        _state.set_query_ctx(_query_ctx.get());
+        _pk_incremental_refresh = config::enable_query_cache_pk_incremental_refresh;
+        config::enable_query_cache_pk_incremental_refresh = true;
+
+        srand(GetCurrentTimeMicros());
+        _tablet = create_tablet(rand(), rand());
+        ASSERT_OK(_tablet->rowset_commit(2, create_rowset(_tablet, keys(0, 100))));
+
+        _cache_param.num_lanes = 1;
+        _cache_param.plan_node_id = 10;
+        _cache_param.digest = "cache_key_";
+        _cache_param.slot_remapping = {{1, 1}};
+        _cache_param.reverse_slot_remapping = {{1, 1}};
+        _cache_param.can_use_multiversion = true;
+        _cache_param.keys_type = TKeysType::PRIMARY_KEYS;
+        _cache_param.is_lake = false;
+        _factory = std::make_shared<query_cache::CacheOperatorFactory>(1, 10, _cache_mgr.get(), _cache_param);
+        _cache_operator = std::dynamic_pointer_cast<query_cache::CacheOperator>(_factory->create(1, 0));
+        ASSERT_OK(_cache_operator->prepare(&_state));
+    }
+
+    void TearDown() override {
+        _cache_operator->close(&_state);
+        config::enable_query_cache_pk_incremental_refresh = _pk_incremental_refresh;
+        TabletUpdatesTest::TearDown();
+    }
+
+    static std::vector<int64_t> keys(int64_t begin, int64_t end) {
+        std::vector<int64_t> keys;
+        for (int64_t i = begin; i < end; i++) {
+            keys.push_back(i);
+        }
+        return keys;
+    }
+
+    // Probes the cache entry of _tablet populated at version 2, returns the version from which the tablet should be
+    // scanned and the delta rowsets to scan, (1, []) means a cache miss.
+    std::tuple<int64_t, std::vector<BaseRowsetSharedPtr>> probe(int64_t version) {
+        auto chunk = std::make_shared<Chunk>();
+        auto column = Int64Column::create();
+        column->append(100);
+        chunk->append_column(std::move(column), 1);
+        chunk->owner_info().set_owner_id(_tablet->tablet_id(), true);
+        query_cache::CacheValue cache_value(0, 2, {chunk});
+
+        _cache_operator->_owner_to_lanes[_tablet->tablet_id()] = 0;
+        _cache_operator->_handle_stale_cache_value_for_pk(_tablet->tablet_id(), cache_value,
+                                                          _cache_operator->_per_lane_buffers[0], version);
+        return _cache_operator->delta_version_and_rowsets(_tablet->tablet_id());
+    }
+
+protected:
+    RuntimeState _state;
+    std::unique_ptr<pipeline::QueryContext> _query_ctx = std::make_unique<pipeline::QueryContext>();
+    query_cache::CacheManagerPtr _cache_mgr = std::make_shared<query_cache::CacheManager>(10240);
+    query_cache::CacheParam _cache_param;
+    std::shared_ptr<query_cache::CacheOperatorFactory> _factory;
+    query_cache::CacheOperatorPtr _cache_operator;
+    bool _pk_incremental_refresh = false;
+};
+
+TEST_F(PkQueryCacheTest, test_append_only_delta_is_partial_hit) {
+    auto delta = create_rowset(_tablet, keys(100, 200));
+    ASSERT_OK(_tablet->rowset_commit(3, delta));
+
+    auto [from_version, rowsets] = probe(3);
+    ASSERT_EQ(3, from_version);
+    ASSERT_EQ(1, rowsets.size());
+    ASSERT_EQ(delta->rowset_id(), rowsets[0]->rowset_id());
+}
+
+TEST_F(PkQueryCacheTest, test_upsert_delta_is_miss) {
+    ASSERT_OK(_tablet->rowset_commit(3, create_rowset(_tablet, keys(50, 150))));
+
+    auto [from_version, rowsets] = probe(3);
+    ASSERT_EQ(1, from_version);
+    ASSERT_TRUE(rowsets.empty());
+}
+
+TEST_F(PkQueryCacheTest, test_delete_delta_is_miss) {
+    auto deleted_keys = keys(0, 10);
+    Int64Column deletes;
+    deletes.append_numbers(deleted_keys.data(), sizeof(int64_t) * deleted_keys.size());
+    ASSERT_OK(_tablet->rowset_commit(3, create_rowset(_tablet, {}, &deletes)));
+
+    auto [from_version, rowsets] = probe(3);
+    ASSERT_EQ(1, from_version);
+    ASSERT_TRUE(rowsets.empty());
+}
+
+TEST_F(PkQueryCacheTest, test_compaction_delta_is_miss) {
+    ASSERT_OK(_tablet->rowset_commit(3, create_rowset(_tablet, keys(100, 200))));
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    // the output rowset of the compaction contains the keys in version 2 and is visible in version 3
+    ASSERT_OK(_tablet->updates()->compaction(_compaction_mem_tracker.get()));
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    ASSERT_EQ(1, _tablet->updates()->num_rowsets());
+
+    auto [from_version, rowsets] = probe(3);
+    ASSERT_EQ(1, from_version);
+    ASSERT_TRUE(rowsets.empty());
+}
+
+TEST_F(PkQueryCacheTest, test_incremental_refresh_disabled) {
+    ASSERT_OK(_tablet->rowset_commit(3, create_rowset(_tablet, keys(100, 200))));
+
+    config::enable_query_cache_pk_incremental_refresh = false;
+    auto [from_version, rowsets] = probe(3);
+    ASSERT_EQ(1, from_version);
+    ASSERT_TRUE(rowsets.empty());
+}
+
+} // namespace starrocks
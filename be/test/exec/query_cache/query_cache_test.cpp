@@ -21,6 +21,7 @@
 #include <utility>
 
 #include "column/fixed_length_column.h"
+#include "common/config.h"
 #include "column/vectorized_fwd.h"
 #include "exec/pipeline/group_execution/execution_group_builder.h"
 #include "exec/pipeline/group_execution/execution_group_fwd.h"
@@ -30,11 +31,16 @@
 #include "exec/query_cache/cache_operator.h"
 #include "exec/query_cache/cache_param.h"
 #include "exec/query_cache/conjugate_operator.h"
+#include "exec/query_cache/disk_cache_tier.h"
 #include "exec/query_cache/lane_arbiter.h"
 #include "exec/query_cache/multilane_operator.h"
 #include "exec/query_cache/ticket_checker.h"
 #include "exec/query_cache/transform_operator.h"
+#include "exec/spill/dir_manager.h"
+#include "fs/fs.h"
 #include "gutil/strings/substitute.h"
+#include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -164,6 +170,141 @@ TEST_F(QueryCacheTest, testCacheManager) {
     ASSERT_GE(cache_mgr->memory_usage(), 0);
 }
 
+TEST_F(QueryCacheTest, testCacheManagerWithDiskTier) {
+    static constexpr size_t CACHE_CAPACITY = 10240;
+    auto path = strings::Substitute("$0/query_cache_disk_tier", config::storage_root_path);
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString(path));
+    ASSERT_OK(fs->create_dir_recursive(path));
+    DeferOp defer([&]() { (void)fs->delete_dir_recursive(path); });
+    auto dir_mgr = std::make_unique<spill::DirManager>(
+            std::vector<spill::DirPtr>{std::make_shared<spill::Dir>(path, fs, INT64_MAX)});
+
+    auto cache_mgr = std::make_shared<query_cache::CacheManager>(CACHE_CAPACITY);
+    ASSERT_OK(cache_mgr->enable_disk_tier(dir_mgr.get(), 1024 * 1024, false));
+    ASSERT_TRUE(cache_mgr->has_disk_tier());
+
+    auto create_cache_value = [](int64_t version, size_t num_rows) {
+        auto chk = std::make_shared<Chunk>();
+        auto col = Int32Column::create();
+        for (auto i = 0; i < num_rows; ++i) {
+            col->append(i);
+        }
+        chk->append_column(std::move(col), 1);
+        chk->owner_info().set_owner_id(1, true);
+        return query_cache::CacheValue(0, version, {chk});
+    };
+
+    // the entries evicted from memory are spilled to disk
+    for (auto i = 0; i < 20; ++i) {
+        cache_mgr->populate(strings::Substitute("key_$0", i), create_cache_value(i, 256));
+    }
+    ASSERT_LE(cache_mgr->memory_usage(), cache_mgr->capacity());
+    ASSERT_GT(cache_mgr->disk_usage(), 0);
+
+    // all the entries can be hit, either in memory or on disk
+    for (auto i = 0; i < 20; ++i) {
+        auto status = cache_mgr->probe(strings::Substitute("key_$0", i));
+        ASSERT_TRUE(status.ok());
+        auto& value = status.value();
+        ASSERT_EQ(value.version, i);
+        ASSERT_EQ(value.result.size(), 1);
+        auto& chunk = value.result[0];
+        ASSERT_EQ(chunk->num_rows(), 256);
+        ASSERT_TRUE(chunk->is_slot_exist(1));
+        ASSERT_EQ(chunk->get_column_by_slot_id(1)->get(255).get_int32(), 255);
+        ASSERT_TRUE(chunk->owner_info().is_last_chunk());
+    }
+    ASSERT_GT(cache_mgr->disk_lookup_count(), 0);
+    ASSERT_GT(cache_mgr->disk_hit_count(), 0);
+    ASSERT_LE(cache_mgr->disk_usage(), cache_mgr->disk_capacity());
+
+    // the stale version on disk is dropped when the entry is populated again
+    for (auto i = 0; i < 20; ++i) {
+        cache_mgr->populate(strings::Substitute("key_$0", i), create_cache_value(i + 100, 256));
+    }
+    for (auto i = 0; i < 20; ++i) {
+        auto status = cache_mgr->probe(strings::Substitute("key_$0", i));
+        ASSERT_TRUE(status.ok());
+        ASSERT_EQ(status.value().version, i + 100);
+    }
+
+    cache_mgr->invalidate_all();
+    ASSERT_EQ(cache_mgr->memory_usage(), 0);
+    ASSERT_EQ(cache_mgr->disk_usage(), 0);
+    for (auto i = 0; i < 20; ++i) {
+        ASSERT_FALSE(cache_mgr->probe(strings::Substitute("key_$0", i)).ok());
+    }
+}
+
+TEST_F(QueryCacheTest, testDiskCacheTierReuseDir) {
+    auto path = strings::Substitute("$0/query_cache_disk_tier", config::storage_root_path);
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString(path));
+    ASSERT_OK(fs->create_dir_recursive(path));
+    DeferOp defer([&]() { (void)fs->delete_dir_recursive(path); });
+    auto spill_dir = std::make_shared<spill::Dir>(path, fs, INT64_MAX);
+    auto dir_mgr = std::make_unique<spill::DirManager>(std::vector<spill::DirPtr>{spill_dir});
+
+    query_cache::DiskCacheTier disk_tier(dir_mgr.get(), 1024 * 1024);
+    ASSERT_OK(disk_tier.init());
+
+    auto create_cache_value = [](int64_t version) {
+        auto chk = std::make_shared<Chunk>();
+        auto col = Int32Column::create();
+        for (auto i = 0; i < 100; ++i) {
+            col->append(i);
+        }
+        chk->append_column(std::move(col), 1);
+        chk->owner_info().set_owner_id(1, true);
+        return query_cache::CacheValue(0, version, {chk});
+    };
+
+    // put -> take -> put -> take, the directory of the disk tier is not removed when it becomes empty
+    ASSERT_OK(disk_tier.put("key", create_cache_value(1)));
+    ASSERT_OK(disk_tier.take("key").status());
+    ASSERT_EQ(0, disk_tier.usage());
+    ASSERT_OK(disk_tier.put("key", create_cache_value(2)));
+    ASSIGN_OR_ABORT(auto value, disk_tier.take("key"));
+    ASSERT_EQ(2, value.version);
+    ASSERT_EQ(100, value.result[0]->num_rows());
+
+    // put -> clear -> put -> take
+    ASSERT_OK(disk_tier.put("key", create_cache_value(3)));
+    disk_tier.clear();
+    ASSERT_OK(disk_tier.put("key", create_cache_value(4)));
+    ASSIGN_OR_ABORT(value, disk_tier.take("key"));
+    ASSERT_EQ(4, value.version);
+
+    // the disk tier is not counted in the capacity of spill dirs
+    ASSERT_OK(disk_tier.put("key", create_cache_value(5)));
+    ASSERT_GT(disk_tier.usage(), 0);
+    ASSERT_EQ(0, spill_dir->get_current_size());
+
+    // the value of a put is discarded if the key is invalidated while it is written
+    auto ticket = disk_tier.prepare_put("key2");
+    disk_tier.erase("key2");
+    ASSERT_OK(disk_tier.put("key2", create_cache_value(6), ticket));
+    ASSERT_TRUE(disk_tier.take("key2").status().is_not_found());
+    ticket = disk_tier.prepare_put("key2");
+    disk_tier.clear();
+    ASSERT_OK(disk_tier.put("key2", create_cache_value(7), ticket));
+    ASSERT_TRUE(disk_tier.take("key2").status().is_not_found());
+    // the older put of the key is superseded by the newer one
+    auto ticket1 = disk_tier.prepare_put("key2");
+    auto ticket2 = disk_tier.prepare_put("key2");
+    ASSERT_OK(disk_tier.put("key2", create_cache_value(9), ticket2));
+    ASSERT_OK(disk_tier.put("key2", create_cache_value(8), ticket1));
+    ASSIGN_OR_ABORT(value, disk_tier.take("key2"));
+    ASSERT_EQ(9, value.version);
+    ASSIGN_OR_ABORT(value, disk_tier.take("key"));
+    ASSERT_EQ(5, value.version);
+    ASSERT_EQ(0, disk_tier.usage());
+
+    // no file is left after all the entries are dropped
+    std::vector<std::string> files;
+    ASSERT_OK(fs->get_children(path + "/query_cache", &files));
+    ASSERT_TRUE(files.empty());
+}
+
 ChunkPtr create_test_chunk(query_cache::LaneOwnerType owner, long from, long to, bool is_last_chunk) {
     ChunkPtr chunk = std::make_shared<Chunk>();
     chunk->owner_info().set_owner_id(owner, is_last_chunk);
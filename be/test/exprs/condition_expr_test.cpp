@@ -17,6 +17,7 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <optional>
 #include <random>
 
 #include "column/column_helper.h"
@@ -24,6 +25,7 @@
 #include "column/fixed_length_column.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "gen_cpp/Exprs_types.h"
 #include "gutil/casts.h"
@@ -479,4 +481,66 @@ TEST_F(VectorizedConditionExprTest, ifExpr) {
     }
 }
 
+TEST_F(VectorizedConditionExprTest, jitConditionExprs) {
+    RuntimeState runtime_state;
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    expr_node.is_nullable = true;
+    // null at odd rows
+    MockNullVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 10);
+    // null at even rows
+    MockNullVectorizedExpr<TYPE_BIGINT> col3(expr_node, 10, 30);
+    col3.flag = 1;
+    MockNullVectorizedExpr<TYPE_BIGINT> col4(expr_node, 10, 20);
+    expr_node.is_nullable = false;
+    MockVectorizedExpr<TYPE_BIGINT> col2(expr_node, 10, 20);
+
+    auto verify = [&](Expr* expr, const std::function<std::optional<int64_t>(int)>& expected) {
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr, &runtime_state, [&](ColumnPtr const& ptr) {
+            ASSERT_EQ(10, ptr->size());
+            for (int j = 0; j < ptr->size(); ++j) {
+                auto value = expected(j);
+                ASSERT_EQ(!value.has_value(), ptr->is_null(j));
+                if (value.has_value()) {
+                    ASSERT_EQ(value.value(), ptr->get(j).get_int64());
+                }
+            }
+        });
+    };
+
+    // ifnull(col1, col2)
+    {
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_if_null_expr(expr_node));
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+        verify(expr.get(), [](int row) { return row % 2 == 0 ? 10 : 20; });
+    }
+    // coalesce(col1, col3)
+    {
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_coalesce_expr(expr_node));
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col3);
+        verify(expr.get(), [](int row) { return row % 2 == 0 ? 10 : 30; });
+    }
+    // nullif(col2, col4)
+    {
+        expr_node.is_nullable = true;
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_null_if_expr(expr_node));
+        expr->_children.push_back(&col2);
+        expr->_children.push_back(&col4);
+        verify(expr.get(), [](int row) { return row % 2 == 0 ? std::nullopt : std::optional<int64_t>(20); });
+    }
+    // if(cond, col1, col2), a null condition selects col2
+    {
+        expr_node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+        MockNullVectorizedExpr<TYPE_BOOLEAN> cond(expr_node, 10, true);
+        expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+        auto expr = std::unique_ptr<Expr>(VectorizedConditionExprFactory::create_if_expr(expr_node));
+        expr->_children.push_back(&cond);
+        expr->_children.push_back(&col1);
+        expr->_children.push_back(&col2);
+        verify(expr.get(), [](int row) { return row % 2 == 0 ? 10 : 20; });
+    }
+}
+
 } // namespace starrocks
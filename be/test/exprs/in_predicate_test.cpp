@@ -17,10 +17,14 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <optional>
+
 #include "butil/time.h"
 #include "column/binary_column.h"
 #include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "exprs/exprs_test_helper.h"
+#include "exprs/literal.h"
 #include "exprs/mock_vectorized_expr.h"
 
 namespace starrocks {
@@ -479,4 +483,58 @@ TEST_F(VectorizedInPredicateTest, inArrayConstAllNULL) {
     }
 }
 
+TEST_F(VectorizedInPredicateTest, jitIntIn) {
+    RuntimeState runtime_state;
+    runtime_state.set_jit_level(-1);
+    ObjectPool pool;
+    expr_node.child_type = TPrimitiveType::INT;
+    expr_node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+    expr_node.is_nullable = true;
+    // 3 at even rows, null at odd rows
+    MockNullVectorizedExpr<TYPE_INT> col(expr_node, 10, 3);
+    auto literal = [&](std::optional<int32_t> value) -> Expr* {
+        ColumnPtr column = value.has_value() ? ColumnHelper::create_const_column<TYPE_INT>(value.value(), 1)
+                                             : ColumnHelper::create_const_null_column(1);
+        return pool.add(new VectorizedLiteral(std::move(column), TypeDescriptor(TYPE_INT)));
+    };
+
+    struct Case {
+        bool is_not_in;
+        std::vector<std::optional<int32_t>> values;
+        // the result of even rows, null if not set
+        std::optional<bool> expected;
+    };
+    std::vector<Case> cases = {{false, {1, 3, 5}, true},
+                               {false, {1, 2}, false},
+                               {false, {1, std::nullopt}, std::nullopt},
+                               {true, {1, 2}, true},
+                               {true, {3, std::nullopt}, false},
+                               {true, {1, std::nullopt}, std::nullopt}};
+    for (const auto& c : cases) {
+        expr_node.opcode = c.is_not_in ? TExprOpcode::FILTER_NOT_IN : TExprOpcode::FILTER_IN;
+        expr_node.in_predicate.is_not_in = c.is_not_in;
+        auto expr = std::unique_ptr<Expr>(VectorizedInPredicateFactory::from_thrift(expr_node));
+        expr->_children.push_back(&col);
+        for (auto value : c.values) {
+            expr->_children.push_back(literal(value));
+        }
+        ASSERT_TRUE(expr->is_compilable(&runtime_state));
+        ASSERT_OK(expr->prepare(nullptr, nullptr));
+        ASSERT_OK(expr->open(nullptr, nullptr, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL));
+
+        ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+        ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, [&](ColumnPtr const& ptr) {
+            ASSERT_EQ(10, ptr->size());
+            for (int j = 0; j < ptr->size(); ++j) {
+                if (j % 2 == 1 || !c.expected.has_value()) {
+                    ASSERT_TRUE(ptr->is_null(j));
+                } else {
+                    ASSERT_FALSE(ptr->is_null(j));
+                    ASSERT_EQ(c.expected.value(), ptr->get(j).get_uint8());
+                }
+            }
+        });
+    }
+}
+
 } // namespace starrocks
@@ -15,13 +15,19 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <filesystem>
+#include <thread>
+
 #include "butil/time.h"
 #include "column/column_hash.h"
 #include "column/fixed_length_column.h"
+#include "common/config.h"
 #include "exprs/arithmetic_expr.h"
 #include "exprs/exprs_test_helper.h"
 #include "exprs/mock_vectorized_expr.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -200,4 +206,93 @@ TEST_F(JITFunctionCacheTest, cache) {
         }
     }
 }
+
+// The compiled object is persisted, and loaded instead of compiled again once evicted from the LRU cache.
+TEST_F(JITFunctionCacheTest, persisted_object) {
+    const std::string dir = "./jit_object_cache_test";
+    config::jit_object_cache_dir = dir;
+    DeferOp defer([&]() {
+        config::jit_object_cache_dir = "";
+        std::filesystem::remove_all(dir);
+    });
+
+    expr_node.opcode = TExprOpcode::SUBTRACT;
+    expr_node.type = gen_type_desc(TPrimitiveType::BIGINT);
+    std::unique_ptr<Expr> expr(VectorizedArithmeticExprFactory::from_thrift(expr_node));
+    MockVectorizedExpr<TYPE_BIGINT> col1(expr_node, 10, 10);
+    MockVectorizedExpr<TYPE_BIGINT> col2(expr_node, 10, 3);
+    expr->_children.push_back(&col1);
+    expr->_children.push_back(&col2);
+
+    auto expr_name = expr->jit_func_name(&runtime_state);
+    ASSERT_EQ(nullptr, engine->load_persisted_object(expr_name));
+
+    auto verify = [](ColumnPtr const& ptr) {
+        auto v = Int64Column::static_pointer_cast(ptr);
+        ASSERT_EQ(10, v->size());
+        for (int j = 0; j < v->size(); ++j) {
+            ASSERT_EQ(7, v->get_data()[j]);
+        }
+    };
+    ColumnPtr ptr = expr->evaluate(nullptr, nullptr);
+    ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, verify);
+    auto persisted = engine->load_persisted_object(expr_name);
+    ASSERT_NE(nullptr, persisted);
+    ASSERT_GT(persisted->getBufferSize(), 0);
+    // the function name tells the hash collisions apart
+    ASSERT_EQ(nullptr, engine->load_persisted_object(expr_name + "x"));
+
+    engine->get_func_cache()->erase(expr_name);
+    auto func_obj = std::make_unique<JitObjectCache>(expr_name, engine->get_func_cache());
+    ASSERT_FALSE(engine->lookup_function(func_obj.get()));
+    const int64_t num_loaded = engine->_num_loaded_persisted_objects;
+    ExprsTestHelper::verify_with_jit(ptr, expr.get(), &runtime_state, verify);
+    ASSERT_TRUE(engine->lookup_function(func_obj.get()));
+    // compiled again from the object file rather than the IR
+    ASSERT_EQ(num_loaded + 1, engine->_num_loaded_persisted_objects);
+}
+
+// The removed object files are not counted, and the oldest ones are evicted once the max number is reached.
+TEST_F(JITFunctionCacheTest, evict_persisted_objects) {
+    const std::string dir = "./jit_object_cache_evict_test";
+    config::jit_object_cache_dir = dir;
+    const int64_t max_files = config::jit_object_cache_max_files;
+    config::jit_object_cache_max_files = 10;
+    engine->_num_persisted_objects = 0;
+    DeferOp defer([&]() {
+        config::jit_object_cache_dir = "";
+        config::jit_object_cache_max_files = max_files;
+        engine->_num_persisted_objects = 0;
+        std::filesystem::remove_all(dir);
+    });
+
+    auto obj_code = llvm::MemoryBuffer::getMemBufferCopy("object code");
+    engine->persist_object("f0", *obj_code);
+    engine->persist_object("f0", *obj_code);
+    ASSERT_EQ(1, engine->_num_persisted_objects);
+    engine->remove_persisted_object("f0");
+    ASSERT_EQ(0, engine->_num_persisted_objects);
+    ASSERT_EQ(nullptr, engine->load_persisted_object("f0"));
+    engine->remove_persisted_object("f0");
+    ASSERT_EQ(0, engine->_num_persisted_objects);
+
+    for (int i = 0; i < 10; ++i) {
+        engine->persist_object("f" + std::to_string(i), *obj_code);
+        // the eviction goes by the modification time
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(10, engine->_num_persisted_objects);
+    engine->persist_object("f10", *obj_code);
+    // evicted to 9 files before persisting f10
+    ASSERT_EQ(10, engine->_num_persisted_objects);
+    ASSERT_EQ(nullptr, engine->load_persisted_object("f0"));
+    for (int i = 1; i <= 10; ++i) {
+        ASSERT_NE(nullptr, engine->load_persisted_object("f" + std::to_string(i)));
+    }
+    size_t num_files = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(dir)) {
+        num_files += entry.path().extension() == ".o";
+    }
+    ASSERT_EQ(10, num_files);
+}
 } // namespace starrocks
@@ -694,4 +694,50 @@ TEST_F(LikeTest, splitLikePatternIntoNgramSet) {
     VectorizedFunctionCallExpr::split_like_string_to_ngram(pattern, options, ngram_set);
     ASSERT_EQ(0, ngram_set.size());
 }
+
+TEST_F(LikeTest, multiPatternMatcher) {
+    std::vector<MultiPatternMatcher::Pattern> patterns = {
+            {"%error%", true}, {"warn_", true}, {"a\\%b", true},        {"c#_d", true, '#'},
+            {"abc", true},     {"%xyz", true},  {"^time.*out$", false}};
+    auto matcher = MultiPatternMatcher::create(patterns);
+    ASSERT_TRUE(matcher.ok()) << matcher.status().message();
+
+    auto str = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    for (const auto& value : {"an error occurs", "warn1", "warn12", "a%b", "axb", "c_d", "cxd", "timeout", "warn1\n",
+                              "abc", "abc\n", "axyz", "axyz\n", ""}) {
+        str->append_datum(Slice(value));
+    }
+    str->append_nulls(1);
+
+    ColumnPtr value_column = std::move(str);
+    auto result = matcher.value()->match(value_column);
+    ASSERT_TRUE(result.ok());
+    auto column = result.value();
+    // as the single predicates, the patterns of the literal fast paths don't match a trailing newline, while the
+    // patterns compiled by hyperscan do
+    std::vector<std::string> expected = {"1", "1", "0", "1", "0", "1", "0", "1", "1",
+                                         "1", "0", "1", "0", "0", "NULL"};
+    ASSERT_EQ(expected.size(), column->size());
+    for (size_t i = 0; i < expected.size(); i++) {
+        EXPECT_EQ(expected[i], column->debug_item(i)) << i;
+    }
+
+    // back references are not supported by hyperscan
+    auto invalid = MultiPatternMatcher::create({{"abc", true}, {"(a)\\1", false}});
+    ASSERT_FALSE(invalid.ok());
+}
+
+TEST_F(LikeTest, hyperscanDatabaseCache) {
+    auto* cache = HyperscanDatabaseCache::instance();
+    auto db1 = cache->get_or_compile({"abc.*d", "x+y"}, {HS_FLAG_DOTALL, HS_FLAG_DOTALL});
+    auto db2 = cache->get_or_compile({"abc.*d", "x+y"}, {HS_FLAG_DOTALL, HS_FLAG_DOTALL});
+    ASSERT_TRUE(db1.ok());
+    ASSERT_TRUE(db2.ok());
+    EXPECT_EQ(db1.value().get(), db2.value().get());
+    EXPECT_GT(cache->memory_usage(), 0);
+
+    auto db3 = cache->get_or_compile({"abc.*d", "x+y"}, {HS_FLAG_DOTALL, HS_FLAG_CASELESS});
+    ASSERT_TRUE(db3.ok());
+    EXPECT_NE(db1.value().get(), db3.value().get());
+}
 } // namespace starrocks
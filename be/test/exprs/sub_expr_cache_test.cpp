@@ -0,0 +1,239 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exprs/sub_expr_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "column/chunk.h"
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exprs/binary_predicate.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "exprs/function_call_expr.h"
+#include "exprs/literal.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "types/logical_type.h"
+
+namespace starrocks {
+
+class SubExprCacheTest : public ::testing::Test {
+protected:
+    void TearDown() override { Expr::close(_ctxs, &_runtime_state); }
+
+    // mod(slot 1, divisor)
+    ExprContext* create_mod_expr(int32_t divisor) {
+        auto* ctx = _pool.add(new ExprContext(create_mod_call(divisor)));
+        _ctxs.emplace_back(ctx);
+        return ctx;
+    }
+
+    // mod(slot 1, divisor) = value
+    ExprContext* create_mod_eq_expr(int32_t divisor, int32_t value) {
+        TExprNode node;
+        node.node_type = TExprNodeType::BINARY_PRED;
+        node.type = gen_type_desc(TPrimitiveType::BOOLEAN);
+        node.num_children = 2;
+        node.__set_opcode(TExprOpcode::EQ);
+        node.__set_child_type(TPrimitiveType::INT);
+
+        auto* expr = _pool.add(VectorizedBinaryPredicateFactory::from_thrift(node));
+        expr->add_child(create_mod_call(divisor));
+        expr->add_child(_pool.add(new VectorizedLiteral(ColumnHelper::create_const_column<TYPE_INT>(value, 1),
+                                                        TypeDescriptor(TYPE_INT))));
+        auto* ctx = _pool.add(new ExprContext(expr));
+        _ctxs.emplace_back(ctx);
+        return ctx;
+    }
+
+    Expr* create_mod_call(int32_t divisor) {
+        TFunctionName name;
+        name.__set_function_name("mod");
+        TFunction function;
+        function.__set_name(name);
+        function.__set_binary_type(TFunctionBinaryType::BUILTIN);
+        function.__set_fid(10252);
+
+        TExprNode node;
+        node.node_type = TExprNodeType::FUNCTION_CALL;
+        node.type = gen_type_desc(TPrimitiveType::INT);
+        node.num_children = 2;
+        node.__set_fn(function);
+
+        auto* expr = _pool.add(new VectorizedFunctionCallExpr(node));
+        expr->add_child(_pool.add(new ColumnRef(TypeDescriptor(TYPE_INT), 1)));
+        expr->add_child(_pool.add(new VectorizedLiteral(ColumnHelper::create_const_column<TYPE_INT>(divisor, 1),
+                                                        TypeDescriptor(TYPE_INT))));
+        return expr;
+    }
+
+    void prepare_and_open() {
+        ASSERT_OK(Expr::prepare(_ctxs, &_runtime_state));
+        ASSERT_OK(Expr::open(_ctxs, &_runtime_state));
+    }
+
+    static ChunkPtr create_chunk(int32_t num_rows) {
+        auto column = Int32Column::create();
+        for (int32_t i = 0; i < num_rows; i++) {
+            column->append(i);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(column), 1);
+        return chunk;
+    }
+
+    static void check_mod(const ColumnPtr& column, int32_t divisor) {
+        for (size_t i = 0; i < column->size(); i++) {
+            ASSERT_EQ(static_cast<int32_t>(i) % divisor, column->get(i).get_int32());
+        }
+    }
+
+    RuntimeState _runtime_state;
+    ObjectPool _pool;
+    std::vector<ExprContext*> _ctxs;
+};
+
+TEST_F(SubExprCacheTest, test_fingerprint) {
+    auto* ctx1 = create_mod_expr(3);
+    auto* ctx2 = create_mod_expr(3);
+    auto* ctx3 = create_mod_expr(4);
+    prepare_and_open();
+
+    ASSERT_FALSE(ctx1->root()->memo_key().empty());
+    ASSERT_EQ(ctx1->root()->memo_key(), ctx2->root()->memo_key());
+    ASSERT_NE(ctx1->root()->memo_key(), ctx3->root()->memo_key());
+    // slot refs and literals are cheap, only function calls are memoized
+    ASSERT_TRUE(ctx1->root()->get_child(0)->memo_key().empty());
+    ASSERT_TRUE(ctx1->root()->get_child(1)->memo_key().empty());
+}
+
+TEST_F(SubExprCacheTest, test_share_between_contexts) {
+    auto* ctx1 = create_mod_expr(3);
+    auto* ctx2 = create_mod_expr(3);
+    auto* ctx3 = create_mod_expr(4);
+    prepare_and_open();
+
+    SubExprCache cache;
+    cache.add({ctx1, ctx2});
+    cache.add({ctx3});
+    ASSERT_FALSE(cache.empty());
+
+    auto chunk = create_chunk(10);
+    {
+        SubExprCacheScope scope(&cache);
+        ASSERT_EQ(&cache, SubExprCache::current());
+        ASSIGN_OR_ABORT(auto column1, ctx1->evaluate(chunk.get()));
+        ASSIGN_OR_ABORT(auto column2, ctx2->evaluate(chunk.get()));
+        ASSIGN_OR_ABORT(auto column3, ctx3->evaluate(chunk.get()));
+        ASSERT_EQ(column1.get(), column2.get());
+        ASSERT_NE(column1.get(), column3.get());
+        check_mod(column2, 3);
+        check_mod(column3, 4);
+        // mod(slot 1, 4) occurs once, nothing to share
+        ASSERT_EQ(1, cache._entries.size());
+    }
+    ASSERT_EQ(nullptr, SubExprCache::current());
+    ASSERT_TRUE(cache._entries.empty());
+
+    // not shared outside of the scope
+    ASSIGN_OR_ABORT(auto column1, ctx1->evaluate(chunk.get()));
+    ASSIGN_OR_ABORT(auto column2, ctx2->evaluate(chunk.get()));
+    ASSERT_NE(column1.get(), column2.get());
+}
+
+TEST_F(SubExprCacheTest, test_chunk_changed) {
+    auto* ctx1 = create_mod_expr(3);
+    auto* ctx2 = create_mod_expr(3);
+    prepare_and_open();
+
+    SubExprCache cache;
+    cache.add({ctx1, ctx2});
+    auto chunk = create_chunk(10);
+    SubExprCacheScope scope(&cache);
+
+    ASSIGN_OR_ABORT(auto column1, ctx1->evaluate(chunk.get()));
+
+    // the column of the slot is replaced
+    auto column = Int32Column::create();
+    for (int32_t i = 0; i < 10; i++) {
+        column->append(i + 1);
+    }
+    chunk->update_column(std::move(column), 1);
+    ASSIGN_OR_ABORT(auto column2, ctx2->evaluate(chunk.get()));
+    ASSERT_NE(column1.get(), column2.get());
+    for (size_t i = 0; i < column2->size(); i++) {
+        ASSERT_EQ(static_cast<int32_t>(i + 1) % 3, column2->get(i).get_int32());
+    }
+
+    // the chunk is filtered
+    Filter filter(10, 0);
+    filter[2] = 1;
+    filter[5] = 1;
+    chunk->filter(filter);
+    ASSIGN_OR_ABORT(auto column3, ctx1->evaluate(chunk.get()));
+    ASSERT_EQ(2, column3->size());
+    ASSERT_EQ(0, column3->get(0).get_int32());
+    ASSERT_EQ(0, column3->get(1).get_int32());
+}
+
+TEST_F(SubExprCacheTest, test_share_under_predicate) {
+    auto* ctx1 = create_mod_eq_expr(3, 0);
+    auto* ctx2 = create_mod_eq_expr(3, 1);
+    prepare_and_open();
+
+    // the shared call is not the root of the contexts, it's evaluated by the binary predicates
+    SubExprCache cache;
+    cache.add({ctx1, ctx2});
+    ASSERT_FALSE(cache.empty());
+
+    auto chunk = create_chunk(10);
+    SubExprCacheScope scope(&cache);
+    ASSIGN_OR_ABORT(auto column1, ctx1->evaluate(chunk.get()));
+    ASSERT_EQ(1, cache._entries.size());
+    const Column* mod_column = cache._entries.begin()->second.result.get();
+    ASSIGN_OR_ABORT(auto column2, ctx2->evaluate(chunk.get()));
+    ASSERT_EQ(1, cache._entries.size());
+    // hit, the memoized column isn't replaced
+    ASSERT_EQ(mod_column, cache._entries.begin()->second.result.get());
+    for (size_t i = 0; i < 10; i++) {
+        ASSERT_EQ(static_cast<uint8_t>(i % 3 == 0), column1->get(i).get_uint8());
+        ASSERT_EQ(static_cast<uint8_t>(i % 3 == 1), column2->get(i).get_uint8());
+    }
+}
+
+TEST_F(SubExprCacheTest, test_disabled) {
+    auto* ctx1 = create_mod_expr(3);
+    auto* ctx2 = create_mod_expr(3);
+    prepare_and_open();
+
+    SubExprCache cache;
+    cache.add({ctx1, ctx2});
+    auto chunk = create_chunk(10);
+
+    config::enable_sub_expr_cache = false;
+    {
+        SubExprCacheScope scope(&cache);
+        ASSERT_EQ(nullptr, SubExprCache::current());
+        ASSIGN_OR_ABORT(auto column1, ctx1->evaluate(chunk.get()));
+        ASSIGN_OR_ABORT(auto column2, ctx2->evaluate(chunk.get()));
+        ASSERT_NE(column1.get(), column2.get());
+    }
+    config::enable_sub_expr_cache = true;
+}
+
+} // namespace starrocks
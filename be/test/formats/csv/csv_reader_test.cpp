@@ -0,0 +1,110 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "formats/csv/csv_reader.h"
+
+#include <gtest/gtest.h>
+
+#include "formats/csv/csv_simd.h"
+
+namespace starrocks::csv {
+
+class StringCSVReader : public CSVReader {
+public:
+    StringCSVReader(std::string data, const CSVParseOptions& options) : CSVReader(options), _data(std::move(data)) {}
+
+    Status _fill_buffer() override {
+        size_t n = std::min(_buff.free_space(), _data.size() - _offset);
+        memcpy(_buff.limit(), _data.data() + _offset, n);
+        _buff.add_limit(n);
+        _offset += n;
+        if (n == 0 && _buff.available() == 0) {
+            return Status::EndOfFile("");
+        }
+        return Status::OK();
+    }
+
+    char* _find_line_delimiter(CSVBuffer& buffer, size_t pos) override {
+        return buffer.find(_parse_options.row_delimiter, pos);
+    }
+
+    std::vector<std::string> next_fields() {
+        CSVRow row;
+        auto st = next_record(row);
+        std::vector<std::string> fields;
+        if (!st.ok()) {
+            return fields;
+        }
+        for (const auto& column : row.columns) {
+            const char* base = column.is_escaped_column ? escapeDataPtr() : buffBasePtr();
+            fields.emplace_back(base + column.start_pos, column.length);
+        }
+        return fields;
+    }
+
+private:
+    std::string _data;
+    size_t _offset = 0;
+};
+
+TEST(CSVReaderTest, test_count_until_any_of) {
+    std::string data(100, 'a');
+    EXPECT_EQ(100, count_until_any_of(data.data(), data.size(), ',', '\n', '"', '\\'));
+    for (size_t pos : {0, 1, 15, 16, 31, 32, 33, 63, 64, 99}) {
+        std::string s = data;
+        s[pos] = '"';
+        if (pos + 1 < s.size()) {
+            s[pos + 1] = ',';
+        }
+        EXPECT_EQ(pos, count_until_any_of(s.data(), s.size(), ',', '\n', '"', '\\'));
+        EXPECT_EQ(pos, count_until_any_of(s.data(), s.size(), '"', '"', '"', '"'));
+        // only the first |pos| bytes are scanned
+        EXPECT_EQ(pos, count_until_any_of(s.data(), pos, '"', '"', '"', '"'));
+    }
+    EXPECT_EQ(0, count_until_any_of(data.data(), 0, 'a', 'a', 'a', 'a'));
+}
+
+TEST(CSVReaderTest, test_more_rows_with_long_columns) {
+    std::string long_column(1000, 'x');
+    std::string data = long_column + ",\"" + long_column + ",y\"\"z\"," + long_column + "\\,w\n" + "a,b,c\n";
+    StringCSVReader reader(data, CSVParseOptions("\n", ",", 0, false, '\\', '"'));
+
+    auto fields = reader.next_fields();
+    ASSERT_EQ(3, fields.size());
+    EXPECT_EQ(long_column, fields[0]);
+    EXPECT_EQ(long_column + ",y\"z", fields[1]);
+    EXPECT_EQ(long_column + ",w", fields[2]);
+
+    fields = reader.next_fields();
+    ASSERT_EQ(3, fields.size());
+    EXPECT_EQ("a", fields[0]);
+    EXPECT_EQ("b", fields[1]);
+    EXPECT_EQ("c", fields[2]);
+
+    EXPECT_TRUE(reader.next_fields().empty());
+}
+
+TEST(CSVReaderTest, test_split_record) {
+    std::string data = std::string(100, 'x') + "," + std::string(50, 'y') + ",,z";
+    StringCSVReader reader("", CSVParseOptions("\n", ",", 0, false));
+    CSVReader::Fields fields;
+    reader.split_record(CSVReader::Record(data), &fields);
+    ASSERT_EQ(4, fields.size());
+    EXPECT_EQ(std::string(100, 'x'), fields[0].to_string());
+    EXPECT_EQ(std::string(50, 'y'), fields[1].to_string());
+    EXPECT_EQ("", fields[2].to_string());
+    EXPECT_EQ("z", fields[3].to_string());
+}
+
+} // namespace starrocks::csv
@@ -90,4 +90,88 @@ TEST(OrcColumnReaderTest, TestDateColumn) {
     }
 }
 
+TEST(OrcColumnReaderTest, TestDirectStringColumn) {
+    const static size_t batchSize = 5;
+
+    MemoryOutputStream buffer(bufferSize);
+    ORC_UNIQUE_PTR<orc::Type> schema(orc::Type::buildTypeFromString("struct<c0:string>"));
+    const orc::Type* orcType = schema->getSubtype(0);
+    std::vector<std::string> values = {"a", "bcd", "", "efgh", "ij"};
+
+    // prepare data.
+    {
+        orc::WriterOptions writerOptions;
+        // disable dictionary encoding
+        writerOptions.setDictionaryKeySizeThreshold(0);
+        ORC_UNIQUE_PTR<orc::Writer> writer = createWriter(*schema, &buffer, writerOptions);
+
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = writer->createRowBatch(batchSize);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c0 = dynamic_cast<orc::StringVectorBatch*>(root->fields[0]);
+
+        for (size_t i = 0; i < batchSize; i++) {
+            c0->data[i] = values[i].data();
+            c0->length[i] = values[i].size();
+            c0->notNull[i] = 1;
+        }
+        c0->notNull[2] = 0;
+        c0->hasNulls = true;
+
+        c0->numElements = batchSize;
+        root->numElements = batchSize;
+        writer->add(*batch);
+        writer->close();
+    }
+
+    // read
+    {
+        orc::ReaderOptions readerOptions;
+        ORC_UNIQUE_PTR<orc::InputStream> inputStream(new MemoryInputStream(buffer.getData(), buffer.getLength()));
+        ORC_UNIQUE_PTR<orc::Reader> reader = createReader(std::move(inputStream), readerOptions);
+
+        orc::RowReaderOptions options;
+        std::list<std::string> columns = {"c0"};
+        options.include(columns);
+        ORC_UNIQUE_PTR<orc::RowReader> rr = reader->createRowReader(options);
+
+        const OrcMappingPtr orcMapping = nullptr;
+        OrcChunkReader orcChunkReader(batchSize, {});
+        orcChunkReader.disable_broker_load_mode();
+
+        TypeDescriptor c0Type = TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR);
+
+        std::unique_ptr<ORCColumnReader> orcColumnReader =
+                ORCColumnReader::create(c0Type, orcType, true, orcMapping, &orcChunkReader).value();
+
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = rr->createRowBatch(batchSize);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c0 = dynamic_cast<orc::StringVectorBatch*>(root->fields[0]);
+        orc::RowReader::ReadPosition pos;
+        EXPECT_TRUE(rr->next(*batch, &pos));
+
+        // values are back to back in the blob
+        ColumnPtr column = ColumnHelper::create_column(c0Type, true);
+        EXPECT_TRUE(orcColumnReader->get_next(c0, column, 0, batchSize).ok());
+        EXPECT_TRUE(orcColumnReader->get_next(c0, column, 3, 2).ok());
+        ASSERT_EQ(batchSize + 2, column->size());
+        EXPECT_EQ("'a'", column->debug_item(0));
+        EXPECT_EQ("'bcd'", column->debug_item(1));
+        EXPECT_EQ("NULL", column->debug_item(2));
+        EXPECT_EQ("'efgh'", column->debug_item(3));
+        EXPECT_EQ("'ij'", column->debug_item(4));
+        EXPECT_EQ("'efgh'", column->debug_item(5));
+        EXPECT_EQ("'ij'", column->debug_item(6));
+
+        // values are not back to back anymore once the batch is filtered
+        uint8_t filter[batchSize] = {1, 0, 1, 0, 1};
+        c0->filter(filter, batchSize, 3);
+        column = ColumnHelper::create_column(c0Type, true);
+        EXPECT_TRUE(orcColumnReader->get_next(c0, column, 0, 3).ok());
+        ASSERT_EQ(3, column->size());
+        EXPECT_EQ("'a'", column->debug_item(0));
+        EXPECT_EQ("NULL", column->debug_item(1));
+        EXPECT_EQ("'ij'", column->debug_item(2));
+    }
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -447,6 +447,9 @@ TEST_F(ParquetEncodingTest, String) {
 
         st = decoder->set_dict(config::vector_chunk_size, num_dicts, dict_decoder.get());
         ASSERT_TRUE(st.ok()) << st.to_string();
+        // "0" ~ "9" and "10" ~ "19", 30 bytes in total
+        ASSERT_EQ(1, decoder->get_dict_avg_value_size());
+        ASSERT_EQ(0, dict_decoder->get_dict_avg_value_size());
 
         DecoderChecker<Slice, true>::check(slices, encoder->build(), decoder.get());
     }
@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <arrow/io/file.h>
 #include <gtest/gtest.h>
+#include <parquet/api/writer.h>
 
 #include <filesystem>
 #include <random>
@@ -27,6 +29,7 @@
 #include "formats/parquet/parquet_ut_base.h"
 #include "fs/fs.h"
 #include "io/shared_buffered_input_stream.h"
+#include "util/defer_op.h"
 
 namespace starrocks::parquet {
 
@@ -622,4 +625,165 @@ TEST_F(PageIndexTest, TestPageIndexNoPageFiltered) {
     EXPECT_EQ(total_row_nums, 19000);
 }
 
+TEST_F(PageIndexTest, TestArrayIsNullPageIndex) {
+    TypeDescriptor type_array(LogicalType::TYPE_ARRAY);
+    type_array.children.emplace_back(TypeDescriptor::from_logical_type(LogicalType::TYPE_INT));
+
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(ColumnHelper::create_column(TypeDescriptor::from_logical_type(LogicalType::TYPE_INT), true),
+                         chunk->num_columns());
+    chunk->append_column(ColumnHelper::create_column(TypeDescriptor::from_logical_type(LogicalType::TYPE_INT), true),
+                         chunk->num_columns());
+    chunk->append_column(
+            ColumnHelper::create_column(TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR), true),
+            chunk->num_columns());
+    chunk->append_column(ColumnHelper::create_column(type_array, true), chunk->num_columns());
+
+    const std::string small_page_file = "./be/test/formats/parquet/test_data/page_index_small_page.parquet";
+
+    auto ctx = _create_file_random_read_context(small_page_file);
+    auto file = _create_file(small_page_file);
+    ctx->conjunct_ctxs_by_slot[3].clear();
+
+    // c3 is null when c0 % 10 == 0, every page of c3 has null values, so no page should be filtered
+    // by the null counts of the column index, and the result must be the same as without page index.
+    std::vector<TExpr> t_conjuncts;
+    ParquetUTBase::is_null_pred(3, true, &t_conjuncts);
+    ParquetUTBase::create_conjunct_ctxs(&_pool, _runtime_state, &t_conjuncts, &ctx->conjunct_ctxs_by_slot[3]);
+
+    Utils::SlotDesc slot_descs[] = {
+            {"c0", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)},
+            {"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)},
+            {"c2", TypeDescriptor::from_logical_type(LogicalType::TYPE_VARCHAR)},
+            {"c3", type_array},
+            {""},
+    };
+    TupleDescriptor* tuple_desc = Utils::create_tuple_descriptor(_runtime_state, &_pool, slot_descs);
+    std::vector<ExprContext*> all_conjuncts = ctx->conjunct_ctxs_by_slot[3];
+    ParquetUTBase::setup_conjuncts_manager(all_conjuncts, nullptr, tuple_desc, _runtime_state, ctx);
+
+    auto file_reader = std::make_shared<FileReader>(config::vector_chunk_size, file.get(),
+                                                    std::filesystem::file_size(small_page_file));
+    Status status = file_reader->init(ctx);
+    ASSERT_TRUE(status.ok());
+
+    size_t total_row_nums = 0;
+    while (!status.is_end_of_file()) {
+        chunk->reset();
+        status = file_reader->get_next(&chunk);
+        ASSERT_TRUE(status.ok() || status.is_end_of_file()) << status;
+        chunk->check_or_die();
+        total_row_nums += chunk->num_rows();
+        for (size_t row_index = 0; row_index < chunk->num_rows(); row_index++) {
+            EXPECT_EQ(chunk->get_column_by_index(0)->get(row_index).get_int32() % 10, 0);
+            EXPECT_TRUE(chunk->get_column_by_index(3)->is_null(row_index));
+        }
+    }
+    EXPECT_EQ(total_row_nums, 2000);
+}
+
+// Write 4 pages of 1000 rows with page index, c0 INT is the row number and c3 ARRAY<INT> of row i is [i],
+// or null if 1000 <= i < 2000 and i % 10 == 0, so only the second page of c3 has null values.
+static void write_array_with_null_page_file(const std::string& file_path) {
+    using ::parquet::schema::GroupNode;
+    using ::parquet::schema::PrimitiveNode;
+    constexpr int kNumRows = 4000;
+
+    auto element = PrimitiveNode::Make("element", ::parquet::Repetition::OPTIONAL, ::parquet::Type::INT32);
+    auto list = GroupNode::Make("list", ::parquet::Repetition::REPEATED, {element});
+    auto node = GroupNode::Make(
+            "schema", ::parquet::Repetition::REQUIRED,
+            {PrimitiveNode::Make("c0", ::parquet::Repetition::OPTIONAL, ::parquet::Type::INT32),
+             GroupNode::Make("c3", ::parquet::Repetition::OPTIONAL, {list}, ::parquet::ConvertedType::LIST)});
+    auto schema = std::static_pointer_cast<GroupNode>(node);
+
+    // a page is flushed after every batch of 1000 values
+    ::parquet::WriterProperties::Builder builder;
+    builder.enable_write_page_index()->disable_dictionary()->data_pagesize(1)->write_batch_size(1000);
+    auto sink = ::arrow::io::FileOutputStream::Open(file_path).ValueOrDie();
+    auto writer = ::parquet::ParquetFileWriter::Open(sink, schema, builder.build());
+    auto* rg_writer = writer->AppendRowGroup();
+
+    std::vector<int32_t> c0_values(kNumRows);
+    std::vector<int16_t> c0_def_levels(kNumRows, 1);
+    std::vector<int32_t> c3_values;
+    std::vector<int16_t> c3_def_levels(kNumRows, 3);
+    std::vector<int16_t> c3_rep_levels(kNumRows, 0);
+    for (int i = 0; i < kNumRows; i++) {
+        c0_values[i] = i;
+        if (i >= 1000 && i < 2000 && i % 10 == 0) {
+            c3_def_levels[i] = 0;
+        } else {
+            c3_values.push_back(i);
+        }
+    }
+    static_cast<::parquet::Int32Writer*>(rg_writer->NextColumn())
+            ->WriteBatch(kNumRows, c0_def_levels.data(), nullptr, c0_values.data());
+    static_cast<::parquet::Int32Writer*>(rg_writer->NextColumn())
+            ->WriteBatch(kNumRows, c3_def_levels.data(), c3_rep_levels.data(), c3_values.data());
+    rg_writer->Close();
+    writer->Close();
+    ASSERT_TRUE(sink->Close().ok());
+}
+
+TEST_F(PageIndexTest, TestArrayIsNullSkipPagesWithoutNull) {
+    const std::string file_path = "./page_index_array_with_null_page.parquet";
+    write_array_with_null_page_file(file_path);
+    DeferOp defer([&]() { std::filesystem::remove(file_path); });
+
+    TypeDescriptor type_array(LogicalType::TYPE_ARRAY);
+    type_array.children.emplace_back(TypeDescriptor::from_logical_type(LogicalType::TYPE_INT));
+
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(ColumnHelper::create_column(TypeDescriptor::from_logical_type(LogicalType::TYPE_INT), true),
+                         chunk->num_columns());
+    chunk->append_column(ColumnHelper::create_column(type_array, true), chunk->num_columns());
+
+    auto ctx = _create_scan_context();
+    Utils::SlotDesc slot_descs[] = {
+            {"c0", TypeDescriptor::from_logical_type(LogicalType::TYPE_INT)},
+            {"c3", type_array},
+            {""},
+    };
+    TupleDescriptor* tuple_desc = Utils::create_tuple_descriptor(_runtime_state, &_pool, slot_descs);
+    Utils::make_column_info_vector(tuple_desc, &ctx->materialized_columns);
+    ctx->slot_descs = tuple_desc->slots();
+    ctx->scan_range = _create_scan_range(file_path);
+
+    // c3 is null
+    std::vector<TExpr> t_conjuncts;
+    ParquetUTBase::is_null_pred(1, true, &t_conjuncts);
+    ParquetUTBase::create_conjunct_ctxs(&_pool, _runtime_state, &t_conjuncts, &ctx->conjunct_ctxs_by_slot[1]);
+    std::vector<ExprContext*> all_conjuncts = ctx->conjunct_ctxs_by_slot[1];
+    ParquetUTBase::setup_conjuncts_manager(all_conjuncts, nullptr, tuple_desc, _runtime_state, ctx);
+
+    auto file = _create_file(file_path);
+    auto file_reader =
+            std::make_shared<FileReader>(config::vector_chunk_size, file.get(), std::filesystem::file_size(file_path));
+    Status status = file_reader->init(ctx);
+    ASSERT_TRUE(status.ok()) << status;
+
+    // the pages of c3 without null values are skipped, only the second page is selected
+    ASSERT_EQ(file_reader->_row_group_readers.size(), 1);
+    SparseRange<uint64_t> expected_range;
+    expected_range.add(Range<uint64_t>(1000, 2000));
+    const auto& range = file_reader->_row_group_readers[0]->get_range();
+    EXPECT_TRUE(range == expected_range) << range.to_string();
+
+    size_t total_row_nums = 0;
+    while (!status.is_end_of_file()) {
+        chunk->reset();
+        status = file_reader->get_next(&chunk);
+        ASSERT_TRUE(status.ok() || status.is_end_of_file()) << status;
+        chunk->check_or_die();
+        total_row_nums += chunk->num_rows();
+        for (size_t row_index = 0; row_index < chunk->num_rows(); row_index++) {
+            int32_t c0 = chunk->get_column_by_index(0)->get(row_index).get_int32();
+            EXPECT_TRUE(c0 >= 1000 && c0 < 2000 && c0 % 10 == 0) << c0;
+            EXPECT_TRUE(chunk->get_column_by_index(1)->is_null(row_index));
+        }
+    }
+    EXPECT_EQ(total_row_nums, 100);
+}
+
 } // namespace starrocks::parquet
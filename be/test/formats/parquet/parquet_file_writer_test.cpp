@@ -31,6 +31,7 @@
 #include "fs/fs.h"
 #include "fs/fs_memory.h"
 #include "testutil/assert.h"
+#include "util/priority_thread_pool.hpp"
 
 namespace starrocks::formats {
 
@@ -1171,4 +1172,52 @@ TEST_F(ParquetFileWriterTest, TestWriteJson) {
     // _read_chunk does not support read json
 }
 
+TEST_F(ParquetFileWriterTest, TestWriteColumnsInParallel) {
+    auto type_int = TypeDescriptor::from_logical_type(TYPE_INT);
+    auto type_int_array = TypeDescriptor::from_logical_type(TYPE_ARRAY);
+    type_int_array.children.push_back(type_int);
+    std::vector<TypeDescriptor> type_descs{type_int, type_int_array, TypeDescriptor::from_logical_type(TYPE_BIGINT)};
+
+    PriorityThreadPool executors("parquet_writer_test", 2, 16);
+    auto column_names = _make_type_names(type_descs);
+    auto output_file = _fs.new_writable_file(_file_path).value();
+    auto output_stream = std::make_unique<parquet::ParquetOutputStream>(std::move(output_file));
+    auto column_evaluators = ColumnSlotIdEvaluator::from_types(type_descs);
+    auto writer_options = std::make_shared<formats::ParquetWriterOptions>();
+    auto writer = std::make_unique<formats::ParquetFileWriter>(
+            _file_path, std::move(output_stream), column_names, type_descs, std::move(column_evaluators),
+            TCompressionType::SNAPPY, writer_options, []() {}, &executors);
+    ASSERT_OK(writer->init());
+
+    const size_t num_rows = 2048;
+    auto chunk = std::make_shared<Chunk>();
+    {
+        auto col0 = ColumnHelper::create_column(type_int, true);
+        auto col1 = ColumnHelper::create_column(type_int_array, true);
+        auto col2 = ColumnHelper::create_column(TypeDescriptor::from_logical_type(TYPE_BIGINT), true);
+        for (size_t i = 0; i < num_rows; i++) {
+            col0->append_datum(Datum(static_cast<int32_t>(i)));
+            col1->append_datum(DatumArray{Datum(static_cast<int32_t>(i)), Datum(static_cast<int32_t>(i + 1))});
+            col2->append_datum(Datum(static_cast<int64_t>(i * 2)));
+        }
+        chunk->append_column(std::move(col0), chunk->num_columns());
+        chunk->append_column(std::move(col1), chunk->num_columns());
+        chunk->append_column(std::move(col2), chunk->num_columns());
+    }
+
+    ASSERT_OK(writer->write(chunk.get()));
+    ASSERT_OK(writer->write(chunk.get()));
+    auto result = writer->commit();
+    ASSERT_OK(result.io_status);
+    ASSERT_EQ(result.file_statistics.record_count, 2 * num_rows);
+
+    auto read_chunk = _read_chunk(type_descs);
+    ASSERT_TRUE(read_chunk != nullptr);
+    ASSERT_EQ(read_chunk->num_rows(), 2 * num_rows);
+    auto expected_chunk = chunk->clone_empty();
+    expected_chunk->append(*chunk);
+    expected_chunk->append(*chunk);
+    parquet::Utils::assert_equal_chunk(expected_chunk.get(), read_chunk.get());
+}
+
 } // namespace starrocks::formats
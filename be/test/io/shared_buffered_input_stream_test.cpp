@@ -179,4 +179,53 @@ TEST_F(SharedBufferedInputStreamTest, test_orc) {
             sb.value()->debug_string());
 }
 
-} // namespace starrocks::io
\ No newline at end of file
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_coalesce_options_from_io_cost) {
+    using CoalesceOptions = io::SharedBufferedInputStream::CoalesceOptions;
+    // 20ms * 100MB/s = 2MB
+    auto options = CoalesceOptions::from_io_cost(20000, 100, 8 * CoalesceOptions::MB);
+    ASSERT_EQ(2 * CoalesceOptions::MB, options.max_dist_size);
+    ASSERT_EQ(8 * CoalesceOptions::MB, options.max_buffer_size);
+
+    // capped by max buffer size
+    options = CoalesceOptions::from_io_cost(1000000, 100, 8 * CoalesceOptions::MB);
+    ASSERT_EQ(8 * CoalesceOptions::MB, options.max_dist_size);
+
+    options = CoalesceOptions::from_io_cost(0, 100, 8 * CoalesceOptions::MB);
+    ASSERT_EQ(0, options.max_dist_size);
+}
+
+PARALLEL_TEST(SharedBufferedInputStreamTest, test_skip_cached_ranges) {
+    size_t len = 1 * 1024 * 1024; // 1MB
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    sb_stream->set_coalesce_options({.max_dist_size = 100 * 1024, .max_buffer_size = 1024 * 1024});
+    // [100k, 200k) is cached
+    sb_stream->set_cached_range_checker(
+            [](int64_t offset, int64_t size) { return offset >= 100 * 1024 && offset + size <= 200 * 1024; });
+
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    ranges.emplace_back(0, 10 * 1024);
+    ranges.emplace_back(100 * 1024, 50 * 1024);
+    ranges.emplace_back(180 * 1024, 10 * 1024);
+    ranges.emplace_back(250 * 1024, 10 * 1024);
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+    ASSERT_EQ(2, sb_stream->skipped_cached_io_count());
+    ASSERT_EQ(60 * 1024, sb_stream->skipped_cached_io_bytes());
+
+    // the gap between the uncached ranges is larger than max_dist_size after the cached ranges are skipped
+    ASSIGN_OR_ABORT(auto sb, sb_stream->find_shared_buffer(0, 10 * 1024));
+    ASSERT_EQ(0, sb->raw_offset);
+    ASSERT_EQ(10 * 1024, sb->raw_size);
+    ASSIGN_OR_ABORT(sb, sb_stream->find_shared_buffer(250 * 1024, 10 * 1024));
+    ASSERT_EQ(250 * 1024, sb->raw_offset);
+    ASSERT_EQ(10 * 1024, sb->raw_size);
+
+    // the cached range is read directly if it is not served by the cache
+    std::string buf(50 * 1024, 0);
+    ASSERT_OK(sb_stream->read_at_fully(100 * 1024, buf.data(), buf.size()));
+    ASSERT_EQ(rand_string.substr(100 * 1024, 50 * 1024), buf);
+    ASSERT_EQ(1, sb_stream->direct_io_count());
+}
+
+} // namespace starrocks::io
@@ -0,0 +1,62 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/runtime_filter_worker.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+using Subtrees = std::vector<std::pair<size_t, size_t>>;
+
+static void check_subtrees_cover(const Subtrees& subtrees, size_t num_targets) {
+    size_t expect_begin = 0;
+    for (const auto& [begin, end] : subtrees) {
+        ASSERT_EQ(expect_begin, begin);
+        ASSERT_LT(begin, end);
+        expect_begin = end;
+    }
+    ASSERT_EQ(num_targets, expect_begin);
+}
+
+TEST(RuntimeFilterWorkerTest, test_binomial_broadcast_tree) {
+    auto subtrees = split_runtime_filter_broadcast_tree(7, 0, false);
+    ASSERT_EQ((Subtrees{{0, 4}, {4, 6}, {6, 7}}), subtrees);
+    check_subtrees_cover(subtrees, 7);
+
+    subtrees = split_runtime_filter_broadcast_tree(7, 0, true);
+    ASSERT_EQ((Subtrees{{0, 1}, {1, 4}, {4, 6}, {6, 7}}), subtrees);
+    check_subtrees_cover(subtrees, 7);
+
+    ASSERT_TRUE(split_runtime_filter_broadcast_tree(0, 0, true).empty());
+}
+
+TEST(RuntimeFilterWorkerTest, test_kary_broadcast_tree) {
+    auto subtrees = split_runtime_filter_broadcast_tree(10, 3, false);
+    ASSERT_EQ((Subtrees{{0, 4}, {4, 7}, {7, 10}}), subtrees);
+    check_subtrees_cover(subtrees, 10);
+
+    subtrees = split_runtime_filter_broadcast_tree(2, 4, false);
+    ASSERT_EQ((Subtrees{{0, 1}, {1, 2}}), subtrees);
+
+    subtrees = split_runtime_filter_broadcast_tree(201, 8, true);
+    ASSERT_EQ(9, subtrees.size());
+    ASSERT_EQ((std::pair<size_t, size_t>{0, 1}), subtrees[0]);
+    check_subtrees_cover(subtrees, 201);
+    for (size_t i = 1; i < subtrees.size(); i++) {
+        ASSERT_EQ(25, subtrees[i].second - subtrees[i].first);
+    }
+}
+
+} // namespace starrocks
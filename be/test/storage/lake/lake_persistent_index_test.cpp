@@ -16,9 +16,12 @@
 
 #include <gtest/gtest.h>
 
+#include "runtime/current_thread.h"
+#include "runtime/mem_tracker.h"
 #include "storage/lake/meta_file.h"
 #include "test_util.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::lake {
 
@@ -250,6 +253,78 @@ TEST_F(LakePersistentIndexTest, test_major_compaction) {
     config::l0_max_mem_usage = l0_max_mem_usage;
 }
 
+TEST_F(LakePersistentIndexTest, test_parallel_major_compaction) {
+    auto l0_max_mem_usage = config::l0_max_mem_usage;
+    auto range_bytes = config::lake_pk_index_sst_compaction_range_bytes;
+    config::l0_max_mem_usage = 10;
+    // split input sstables into as many ranges as possible.
+    config::lake_pk_index_sst_compaction_range_bytes = 1;
+    DeferOp defer([&]() {
+        config::l0_max_mem_usage = l0_max_mem_usage;
+        config::lake_pk_index_sst_compaction_range_bytes = range_bytes;
+    });
+    ASSERT_TRUE(_tablet_mgr->update_mgr()->pk_index_compaction_pool() != nullptr);
+    using Key = uint64_t;
+    const int M = 5;
+    const int N = 5000;
+    auto tablet_id = _tablet_metadata->id();
+    auto index = std::make_unique<LakePersistentIndex>(_tablet_mgr.get(), tablet_id);
+    ASSERT_OK(index->init(_tablet_metadata->sstable_meta()));
+    // every round upserts an overlapped key range with new values, and deletes some keys in the last round.
+    vector<Key> total_keys(M * N);
+    for (int i = 0; i < M; ++i) {
+        vector<Key> keys(N);
+        vector<Slice> key_slices(N);
+        vector<IndexValue> values(N);
+        for (int j = 0; j < N; j++) {
+            keys[j] = i * N / 2 + j;
+            key_slices[j] = Slice((uint8_t*)(&keys[j]), sizeof(Key));
+            values[j] = IndexValue(i * N + j);
+        }
+        index->prepare(EditVersion(i, 0), 0);
+        vector<IndexValue> upsert_old_values(N);
+        ASSERT_OK(index->upsert(N, key_slices.data(), values.data(), upsert_old_values.data()));
+        if (i == M - 1) {
+            vector<IndexValue> erase_old_values(N / 10);
+            ASSERT_OK(index->erase(N / 10, key_slices.data(), erase_old_values.data(), i));
+        }
+        index->minor_compact();
+    }
+    const int total = (M - 1) * N / 2 + N;
+    vector<Key> keys(total);
+    vector<Slice> key_slices(total);
+    for (int k = 0; k < total; k++) {
+        keys[k] = k;
+        key_slices[k] = Slice((uint8_t*)(&keys[k]), sizeof(Key));
+    }
+
+    Tablet tablet(_tablet_mgr.get(), tablet_id);
+    auto tablet_metadata_ptr = std::make_shared<TabletMetadata>();
+    tablet_metadata_ptr->CopyFrom(*_tablet_metadata);
+    MetaFileBuilder builder(tablet, tablet_metadata_ptr);
+    ASSERT_OK(index->commit(&builder));
+    vector<IndexValue> expected_values(total);
+    ASSERT_OK(index->get(total, key_slices.data(), expected_values.data()));
+
+    auto txn_log = std::make_shared<TxnLogPB>();
+    // the merged ranges are charged to the tracker of the compaction, its limit is exceeded all the time so that
+    // the ranges are merged one by one.
+    auto mem_tracker = std::make_unique<MemTracker>(1, "pk_index_major_compaction");
+    {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker.get());
+        ASSERT_OK(LakePersistentIndex::major_compact(_tablet_mgr.get(), *tablet_metadata_ptr, txn_log.get()));
+    }
+    ASSERT_GT(mem_tracker->peak_consumption(), 0);
+    ASSERT_TRUE(txn_log->op_compaction().input_sstables_size() > 0);
+    ASSERT_TRUE(txn_log->op_compaction().has_output_sstable());
+    ASSERT_OK(index->apply_opcompaction(txn_log->op_compaction()));
+    vector<IndexValue> get_values(total);
+    ASSERT_OK(index->get(total, key_slices.data(), get_values.data()));
+    for (int k = 0; k < total; k++) {
+        ASSERT_EQ(expected_values[k], get_values[k]);
+    }
+}
+
 TEST_F(LakePersistentIndexTest, test_compaction_strategy) {
     PersistentIndexSstableMetaPB sstable_meta;
     std::vector<PersistentIndexSstablePB> sstables;
@@ -240,6 +240,54 @@ TEST_F(MetaFileTest, test_delvec_read_loop) {
     }
 }
 
+TEST_F(MetaFileTest, test_delvec_rewrite_in_batch) {
+    const int64_t tablet_id = 10003;
+    const uint32_t segment_id = 1234;
+    const int64_t version = 11;
+    auto tablet = std::make_shared<Tablet>(_tablet_manager.get(), tablet_id);
+    auto metadata = std::make_shared<TabletMetadata>();
+    metadata->set_id(tablet_id);
+    metadata->set_version(version);
+    metadata->set_next_rowset_id(110);
+    metadata->mutable_schema()->set_keys_type(PRIMARY_KEYS);
+
+    // the delvec of the same segment is updated by two txns of one publish batch
+    MetaFileBuilder builder(*tablet, metadata);
+    DelVector dv;
+    dv.set_empty();
+    std::shared_ptr<DelVector> ndv;
+    dv.add_dels_as_new_version({1, 3, 5}, version - 1, &ndv);
+    builder.append_delvec(ndv, segment_id);
+
+    DelVectorPtr found_dv;
+    ASSIGN_OR_ABORT(auto found, builder.find_delvec(TabletSegmentId(tablet_id, segment_id), &found_dv));
+    ASSERT_TRUE(found);
+    ASSERT_EQ(ndv->save(), found_dv->save());
+    ASSIGN_OR_ABORT(found, builder.find_delvec(TabletSegmentId(tablet_id, segment_id + 1), &found_dv));
+    ASSERT_FALSE(found);
+
+    std::shared_ptr<DelVector> ndv2;
+    found_dv->add_dels_as_new_version({7, 9}, version, &ndv2);
+    builder.append_delvec(ndv2, segment_id);
+    ASSERT_OK(builder.finalize(next_id()));
+
+    // only the latest delvec is written to delvec file
+    ASSIGN_OR_ABORT(auto metadata2, _tablet_manager->get_tablet_metadata(tablet_id, version));
+    auto iter = metadata2->delvec_meta().delvecs().find(segment_id);
+    ASSERT_TRUE(iter != metadata2->delvec_meta().delvecs().end());
+    EXPECT_EQ(version, iter->second.version());
+    EXPECT_EQ(0, iter->second.offset());
+    auto file_iter = metadata2->delvec_meta().version_to_file().find(version);
+    ASSERT_TRUE(file_iter != metadata2->delvec_meta().version_to_file().end());
+    EXPECT_EQ(iter->second.size(), file_iter->second.size());
+
+    DelVector after_delvec;
+    LakeIOOptions lake_io_opts;
+    ASSERT_OK(get_del_vec(_tablet_manager.get(), *metadata2, segment_id, false, lake_io_opts, &after_delvec));
+    EXPECT_EQ(ndv2->save(), after_delvec.save());
+    EXPECT_EQ(5, after_delvec.cardinality());
+}
+
 TEST_F(MetaFileTest, test_dcg) {
     // 1. generate metadata
     const int64_t tablet_id = 10001;
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include <future>
+#include <thread>
 
 #include "column/chunk.h"
 #include "column/datum_tuple.h"
@@ -25,6 +26,7 @@
 #include "column/vectorized_fwd.h"
 #include "common/logging.h"
 #include "storage/chunk_helper.h"
+#include "storage/lake/metadata_prefetcher.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/lake/tablet_reader.h"
 #include "storage/lake/tablet_writer.h"
@@ -361,4 +363,43 @@ TEST_F(LakeMetacacheTest, test_combined_txn_log_cache) {
     ASSERT_TRUE(log4 == nullptr);
 }
 
+TEST_F(LakeMetacacheTest, test_metadata_prefetch) {
+    auto* metacache = _tablet_mgr->metacache();
+    auto* prefetcher = _tablet_mgr->metadata_prefetcher();
+    ASSERT_TRUE(prefetcher != nullptr);
+    const auto tablet_id = _tablet_metadata->id();
+    const auto version = _tablet_metadata->version();
+    auto location = _tablet_mgr->tablet_metadata_location(tablet_id, version);
+
+    _tablet_mgr->prune_metacache();
+    ASSERT_TRUE(metacache->lookup_tablet_metadata(location) == nullptr);
+    ASSERT_OK(prefetcher->prefetch_tablet(tablet_id, version));
+    ASSERT_TRUE(metacache->lookup_tablet_metadata(location) != nullptr);
+
+    // prefetch in background, nonexistent tablets are ignored
+    _tablet_mgr->prune_metacache();
+    prefetcher->prefetch({{tablet_id, version}, {next_id(), 1}});
+    for (int i = 0; i < 100 && metacache->lookup_tablet_metadata(location) == nullptr; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    ASSERT_TRUE(metacache->lookup_tablet_metadata(location) != nullptr);
+
+    ASSERT_FALSE(prefetcher->prefetch_tablet(next_id(), 1).ok());
+
+    // a tablet being prefetched is skipped, whatever the version is
+    // wait for the background prefetch above to finish
+    bool started = false;
+    for (int i = 0; i < 100 && !(started = prefetcher->_try_start(tablet_id)); i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    ASSERT_TRUE(started);
+    _tablet_mgr->prune_metacache();
+    ASSERT_OK(prefetcher->prefetch_tablet(tablet_id, version));
+    prefetcher->prefetch({{tablet_id, version}});
+    ASSERT_TRUE(metacache->lookup_tablet_metadata(location) == nullptr);
+    prefetcher->_finish(tablet_id);
+    ASSERT_OK(prefetcher->prefetch_tablet(tablet_id, version));
+    ASSERT_TRUE(metacache->lookup_tablet_metadata(location) != nullptr);
+}
+
 } // namespace starrocks::lake
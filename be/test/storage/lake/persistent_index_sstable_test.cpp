@@ -32,6 +32,7 @@
 #include "storage/sstable/table_builder.h"
 #include "testutil/assert.h"
 #include "util/phmap/btree.h"
+#include "util/threadpool.h"
 
 namespace starrocks::lake {
 
@@ -420,6 +421,55 @@ TEST_F(PersistentIndexSstableTest, test_persistent_index_sstable) {
     }
 }
 
+TEST_F(PersistentIndexSstableTest, test_multi_get_with_prefetch_pool) {
+    const int N = 10000;
+    const std::string filename = "test_multi_get_with_prefetch_pool.sst";
+    ASSIGN_OR_ABORT(auto file, fs::new_writable_file(lake::join_path(kTestDir, filename)));
+    phmap::btree_map<std::string, IndexValueWithVer, std::less<>> map;
+    for (int i = 0; i < N; i += 2) {
+        map.emplace(fmt::format("test_key_{:016X}", i), std::make_pair(100, IndexValue(i)));
+    }
+    uint64_t filesize = 0;
+    ASSERT_OK(PersistentIndexSstable::build_sstable(map, file.get(), &filesize));
+
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("test_sst_prefetch").set_max_threads(4).build(&pool));
+    std::unique_ptr<Cache> cache_ptr(new_lru_cache(1024 * 1024));
+    PersistentIndexSstablePB sstable_pb;
+    sstable_pb.set_filename(filename);
+    sstable_pb.set_filesize(filesize);
+    auto sst = std::make_unique<PersistentIndexSstable>();
+    ASSIGN_OR_ABORT(auto read_file, fs::new_random_access_file(lake::join_path(kTestDir, filename)));
+    ASSERT_OK(sst->init(std::move(read_file), sstable_pb, cache_ptr.get(), true, pool.get()));
+
+    // keys spread over many blocks, half of them do not exist. Run twice so that the second
+    // round reads all blocks from cache.
+    for (int round = 0; round < 2; round++) {
+        std::vector<std::string> keys_str(N);
+        std::vector<Slice> keys(N);
+        std::vector<IndexValue> values(N, IndexValue(NullIndexValue));
+        KeyIndexSet key_indexes;
+        KeyIndexSet found_key_indexes;
+        for (int i = 0; i < N; i++) {
+            keys_str[i] = fmt::format("test_key_{:016X}", (i * 7919) % N);
+            keys[i] = Slice(keys_str[i]);
+            key_indexes.insert(i);
+        }
+        ASSERT_OK(sst->multi_get(keys.data(), key_indexes, -1, values.data(), &found_key_indexes));
+        ASSERT_EQ(N / 2, found_key_indexes.size());
+        for (int i = 0; i < N; i++) {
+            int k = (i * 7919) % N;
+            if (k % 2 == 0) {
+                ASSERT_TRUE(found_key_indexes.count(i) > 0);
+                ASSERT_EQ(IndexValue(k), values[i]);
+            } else {
+                ASSERT_TRUE(found_key_indexes.count(i) == 0);
+                ASSERT_EQ(IndexValue(NullIndexValue), values[i]);
+            }
+        }
+    }
+}
+
 TEST_F(PersistentIndexSstableTest, test_index_value_protobuf) {
     IndexValuesWithVerPB index_value_pb;
     for (int i = 0; i < 10; i++) {
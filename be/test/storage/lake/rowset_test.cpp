@@ -18,16 +18,23 @@
 #include "column/fixed_length_column.h"
 #include "column/schema.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/logging.h"
+#include "gen_cpp/segment.pb.h"
 #include "storage/chunk_helper.h"
+#include "storage/lake/filenames.h"
 #include "storage/lake/metacache.h"
+#include "storage/lake/segment_meta_bundle.h"
 #include "storage/lake/tablet_manager.h"
 #include "storage/lake/tablet_writer.h"
 #include "storage/lake/transactions.h"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
 #include "storage/tablet_schema.h"
 #include "test_util.h"
 #include "testutil/assert.h"
 #include "testutil/id_generator.h"
+#include "util/defer_op.h"
 
 namespace starrocks::lake {
 
@@ -148,6 +155,70 @@ TEST_F(LakeRowsetTest, test_load_segments) {
     }
 }
 
+TEST_F(LakeRowsetTest, test_load_segments_with_meta_bundle) {
+    const bool old_val = config::lake_enable_segment_meta_bundle;
+    config::lake_enable_segment_meta_bundle = true;
+    DeferOp defer([&]() { config::lake_enable_segment_meta_bundle = old_val; });
+
+    create_rowsets_for_testing();
+
+    const auto& rowset_meta = _tablet_metadata->rowsets(0);
+    ASSERT_EQ(3, rowset_meta.segments_size());
+    auto bundle_name = segment_meta_bundle_filename(rowset_meta.segments(0));
+    auto bundle_path = _tablet_mgr->segment_location(_tablet_metadata->id(), bundle_name);
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString(bundle_path));
+    ASSIGN_OR_ABORT(auto bundle, SegmentMetaBundle::read(fs.get(), bundle_path));
+    ASSERT_EQ(3, bundle->num_segments());
+    for (const auto& segment : rowset_meta.segments()) {
+        SegmentFooterPB footer;
+        ASSERT_OK(bundle->get_footer(segment, &footer));
+        ASSERT_EQ(34, footer.num_rows());
+    }
+    SegmentFooterPB footer;
+    ASSERT_TRUE(bundle->get_footer("not_exist.dat", &footer).is_not_found());
+
+    ASSIGN_OR_ABORT(auto tablet, _tablet_mgr->get_tablet(_tablet_metadata->id()));
+    ASSIGN_OR_ABORT(auto rowsets, tablet.get_rowsets(2));
+    ASSERT_EQ(1, rowsets.size());
+
+    auto check_segments = [&]() {
+        _tablet_mgr->metacache()->prune();
+        ASSIGN_OR_ABORT(auto segments, rowsets[0]->segments(false));
+        ASSERT_EQ(3, segments.size());
+        for (const auto& seg : segments) {
+            ASSERT_EQ(34, seg->num_rows());
+            OlapReaderStatistics stats;
+            SegmentReadOptions opts;
+            opts.fs = fs;
+            opts.tablet_id = _tablet_metadata->id();
+            opts.stats = &stats;
+            opts.chunk_size = 1024;
+            ASSIGN_OR_ABORT(auto iter, seg->new_iterator(*_schema, opts));
+            auto chunk = ChunkHelper::new_chunk(*_schema, 1024);
+            ASSERT_OK(iter->get_next(chunk.get()));
+            ASSERT_EQ(34, chunk->num_rows());
+            ASSERT_EQ(1, chunk->get(0)[0].get_int32());
+            iter->close();
+        }
+    };
+
+    // open segments with the footers in the bundle
+    check_segments();
+
+    // a corrupted bundle is ignored
+    {
+        ASSIGN_OR_ABORT(auto wf, fs->new_writable_file(bundle_path));
+        ASSERT_OK(wf->append("corrupted segment meta bundle"));
+        ASSERT_OK(wf->close());
+        ASSERT_TRUE(SegmentMetaBundle::read(fs.get(), bundle_path).status().is_corruption());
+    }
+    check_segments();
+
+    // a missing bundle is ignored
+    ASSERT_OK(fs->delete_file(bundle_path));
+    check_segments();
+}
+
 TEST_F(LakeRowsetTest, test_segment_update_cache_size) {
     create_rowsets_for_testing();
 
@@ -261,6 +332,15 @@ TEST_F(LakeRowsetTest, test_partial_compaction) {
     EXPECT_EQ(files_to_delete.size(), 2);
     EXPECT_TRUE(files_to_delete[0].find(writer->files()[0].path) != std::string::npos);
     EXPECT_TRUE(files_to_delete[1].find(writer->files()[1].path) != std::string::npos);
+
+    // the segment meta bundle named after x may be written while bundles are enabled
+    const bool old_val = config::lake_enable_segment_meta_bundle;
+    config::lake_enable_segment_meta_bundle = true;
+    DeferOp defer([&]() { config::lake_enable_segment_meta_bundle = old_val; });
+    files_to_delete.clear();
+    collect_files_in_log(_tablet_mgr.get(), txn_log, &files_to_delete);
+    EXPECT_EQ(files_to_delete.size(), 3);
+    EXPECT_TRUE(files_to_delete[2].find(segment_meta_bundle_filename(writer->files()[0].path)) != std::string::npos);
 }
 
 } // namespace starrocks::lake
@@ -14,6 +14,7 @@
 
 #include "storage/lake/vacuum.h"
 
+#include <fmt/format.h>
 #include <gtest/gtest.h>
 
 #include <ctime>
@@ -1460,6 +1461,64 @@ TEST_P(LakeVacuumTest, test_vacuumed_version) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_P(LakeVacuumTest, test_vacuum_tablets_in_parallel) {
+    const int32_t old_parallelism = config::lake_vacuum_tablet_parallelism;
+    config::lake_vacuum_tablet_parallelism = 4;
+    DeferOp defer([&]() { config::lake_vacuum_tablet_parallelism = old_parallelism; });
+
+    const int64_t kNumTablets = 17;
+    auto input_segment = [](int64_t tablet_id) { return fmt::format("{:016X}_input.dat", tablet_id); };
+    auto output_segment = [](int64_t tablet_id) { return fmt::format("{:016X}_output.dat", tablet_id); };
+    VacuumRequest request;
+    for (int64_t tablet_id = 20001; tablet_id < 20001 + kNumTablets; tablet_id++) {
+        create_data_file(input_segment(tablet_id));
+        create_data_file(output_segment(tablet_id));
+
+        TabletMetadataPB metadata;
+        metadata.set_id(tablet_id);
+        metadata.set_version(1);
+        metadata.set_commit_time(1687331100);
+        ASSERT_OK(_tablet_mgr->put_tablet_metadata(metadata));
+
+        metadata.set_version(2);
+        metadata.add_rowsets()->add_segments(input_segment(tablet_id));
+        ASSERT_OK(_tablet_mgr->put_tablet_metadata(metadata));
+
+        // version 3 compacts the rowset of version 2
+        metadata.set_version(3);
+        metadata.set_prev_garbage_version(2);
+        metadata.add_compaction_inputs()->CopyFrom(metadata.rowsets(0));
+        metadata.mutable_rowsets(0)->set_segments(0, output_segment(tablet_id));
+        ASSERT_OK(_tablet_mgr->put_tablet_metadata(metadata));
+
+        auto* tablet_info = request.add_tablet_infos();
+        tablet_info->set_tablet_id(tablet_id);
+        tablet_info->set_min_version(1);
+    }
+
+    VacuumResponse response;
+    request.set_min_retain_version(3);
+    request.set_grace_timestamp(1687331159);
+    request.set_min_active_txn_id(12345);
+    vacuum(_tablet_mgr.get(), request, &response);
+    ASSERT_TRUE(response.has_status());
+    EXPECT_EQ(0, response.status().status_code()) << response.status().error_msgs(0);
+    // one segment and two metadata files of each tablet
+    EXPECT_EQ(3 * kNumTablets, response.vacuumed_files());
+    EXPECT_EQ(3, response.vacuumed_version());
+    ASSERT_EQ(kNumTablets, response.tablet_infos_size());
+    for (const auto& tablet_info : response.tablet_infos()) {
+        auto tablet_id = tablet_info.tablet_id();
+        EXPECT_EQ(3, tablet_info.min_version());
+        EXPECT_FALSE(file_exist(input_segment(tablet_id)));
+        EXPECT_TRUE(file_exist(output_segment(tablet_id)));
+        EXPECT_FALSE(file_exist(tablet_metadata_filename(tablet_id, 1)));
+        EXPECT_FALSE(file_exist(tablet_metadata_filename(tablet_id, 2)));
+        EXPECT_TRUE(file_exist(tablet_metadata_filename(tablet_id, 3)));
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(LakeVacuumTest, LakeVacuumTest,
                          ::testing::Values(VacuumTestArg{1}, VacuumTestArg{3}, VacuumTestArg{100}));
 
@@ -0,0 +1,168 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/primary_key_row_cache.h"
+
+#include <gtest/gtest.h>
+
+#include "column/binary_column.h"
+#include "column/fixed_length_column.h"
+#include "runtime/mem_tracker.h"
+
+namespace starrocks {
+
+class PrimaryKeyRowCacheTest : public testing::Test {
+protected:
+    static constexpr int64_t kTabletId = 10001;
+
+    static MutableColumnPtr create_pks(const std::vector<int64_t>& keys) {
+        auto pks = Int64Column::create();
+        for (auto key : keys) {
+            pks->append(key);
+        }
+        return pks;
+    }
+
+    static BinaryColumn::MutablePtr create_rows(const std::vector<std::string>& rows) {
+        auto column = BinaryColumn::create();
+        for (const auto& row : rows) {
+            column->append(Slice(row));
+        }
+        return column;
+    }
+
+    // load rows of all the keys at `version`, and return the number of rows hit in cache
+    size_t load(int64_t version, const std::vector<int64_t>& keys, const std::vector<std::string>& rows) {
+        auto pks = create_pks(keys);
+        std::vector<uint8_t> hits;
+        auto cached = BinaryColumn::create();
+        int64_t generation = _cache.multi_get(kTabletId, version, *pks, &hits, cached.get());
+        std::vector<uint32_t> idxes;
+        std::vector<std::string> loaded;
+        for (uint32_t i = 0; i < keys.size(); i++) {
+            if (!hits[i]) {
+                idxes.push_back(i);
+                loaded.push_back(rows[i]);
+            }
+        }
+        _cache.insert(kTabletId, version, generation, *pks, idxes, *create_rows(loaded));
+        return cached->size();
+    }
+
+    PrimaryKeyRowCache _cache{1024 * 1024};
+};
+
+TEST_F(PrimaryKeyRowCacheTest, test_multi_get) {
+    ASSERT_EQ(0, load(2, {1, 2, 3}, {"a", "b", "c"}));
+    ASSERT_EQ(3, load(2, {1, 2, 3}, {"a", "b", "c"}));
+
+    auto pks = create_pks({3, 4, 1});
+    std::vector<uint8_t> hits;
+    auto rows = BinaryColumn::create();
+    _cache.multi_get(kTabletId, 2, *pks, &hits, rows.get());
+    ASSERT_EQ(std::vector<uint8_t>({1, 0, 1}), hits);
+    ASSERT_EQ(2, rows->size());
+    ASSERT_EQ("c", rows->get_slice(0).to_string());
+    ASSERT_EQ("a", rows->get_slice(1).to_string());
+
+    // rows can not be read at older versions, or versions not applied yet
+    ASSERT_EQ(0, load(1, {1, 2, 3}, {"a", "b", "c"}));
+    ASSERT_EQ(0, load(3, {1, 2, 3}, {"a", "b", "c"}));
+    ASSERT_GT(_cache.lookup_count(), 0);
+}
+
+TEST_F(PrimaryKeyRowCacheTest, test_apply) {
+    ASSERT_EQ(0, load(2, {1, 2, 3}, {"a", "b", "c"}));
+
+    // key 2 is updated in version 3
+    _cache.begin_apply(kTabletId);
+    _cache.erase(kTabletId, *create_pks({2}));
+    // rows loaded during apply are not cached
+    ASSERT_EQ(2, load(2, {1, 2, 3}, {"a", "b", "c"}));
+    _cache.end_apply(kTabletId, 3);
+
+    // rows loaded at version 2 are not cached after version 3 is applied
+    ASSERT_EQ(2, load(2, {1, 2, 3}, {"a", "b", "c"}));
+    ASSERT_EQ(2, load(3, {1, 2, 3}, {"a", "b2", "c"}));
+    ASSERT_EQ(3, load(3, {1, 2, 3}, {"a", "b2", "c"}));
+
+    auto pks = create_pks({2});
+    std::vector<uint8_t> hits;
+    auto rows = BinaryColumn::create();
+    _cache.multi_get(kTabletId, 3, *pks, &hits, rows.get());
+    ASSERT_EQ("b2", rows->get_slice(0).to_string());
+
+    // failed apply drops all the rows
+    _cache.begin_apply(kTabletId);
+    _cache.end_apply(kTabletId, -1);
+    ASSERT_EQ(0, load(3, {1, 2, 3}, {"a", "b2", "c"}));
+    ASSERT_EQ(3, load(3, {1, 2, 3}, {"a", "b2", "c"}));
+}
+
+TEST_F(PrimaryKeyRowCacheTest, test_invalidate) {
+    ASSERT_EQ(0, load(2, {1, 2, 3}, {"a", "b", "c"}));
+    auto pks = create_pks({1, 2, 3});
+    std::vector<uint8_t> hits;
+    auto rows = BinaryColumn::create();
+    int64_t generation = _cache.multi_get(kTabletId, 2, *pks, &hits, rows.get());
+
+    _cache.invalidate(kTabletId);
+    ASSERT_EQ(0, load(5, {1, 2, 3}, {"x", "y", "z"}));
+    // rows loaded before invalidation are dropped
+    _cache.insert(kTabletId, 5, generation, *pks, {0, 1, 2}, *create_rows({"a", "b", "c"}));
+    rows->reset_column();
+    _cache.multi_get(kTabletId, 5, *pks, &hits, rows.get());
+    ASSERT_EQ(3, rows->size());
+    ASSERT_EQ("x", rows->get_slice(0).to_string());
+
+    // other tablets are not affected
+    _cache.multi_get(kTabletId + 1, 5, *pks, &hits, rows.get());
+    ASSERT_EQ(std::vector<uint8_t>({0, 0, 0}), hits);
+}
+
+TEST_F(PrimaryKeyRowCacheTest, test_prune_states) {
+    MemTracker mem_tracker(-1, "pk_row_cache");
+    {
+        PrimaryKeyRowCache cache(1024 * 1024, &mem_tracker);
+        auto pks = create_pks({1, 2, 3});
+        std::vector<uint8_t> hits;
+        auto rows = BinaryColumn::create();
+        int64_t generation = cache.multi_get(kTabletId, 2, *pks, &hits, rows.get());
+        cache.insert(kTabletId, 2, generation, *pks, {0, 1, 2}, *create_rows({"a", "b", "c"}));
+        cache.multi_get(kTabletId + 1, 2, *pks, &hits, rows.get());
+        ASSERT_EQ(2, cache.num_states());
+        ASSERT_GT(mem_tracker.consumption(), 0);
+        int64_t consumption = mem_tracker.consumption();
+
+        // states accessed recently are kept
+        ASSERT_EQ(0, cache.prune_states(3600 * 1000));
+        // states being applied are kept
+        cache.begin_apply(kTabletId + 1);
+        ASSERT_EQ(1, cache.prune_states(-1));
+        ASSERT_EQ(1, cache.num_states());
+        cache.end_apply(kTabletId + 1, 3);
+        ASSERT_EQ(1, cache.prune_states(-1));
+        ASSERT_EQ(0, cache.num_states());
+
+        // the rows cached before the state is pruned can not be hit any more
+        rows->reset_column();
+        cache.multi_get(kTabletId, 2, *pks, &hits, rows.get());
+        ASSERT_EQ(std::vector<uint8_t>({0, 0, 0}), hits);
+        // the pruned states are released, a new state is created for kTabletId
+        ASSERT_LT(mem_tracker.consumption(), consumption);
+    }
+    ASSERT_EQ(0, mem_tracker.consumption());
+}
+
+} // namespace starrocks
@@ -152,6 +152,20 @@ TEST_F(CacheTest, HitAndMiss) {
     ASSERT_EQ(101, _deleted_values[0]);
 }
 
+TEST_F(CacheTest, Contains) {
+    std::string result;
+    ASSERT_FALSE(_cache->contains(EncodeKey(&result, 100)));
+    Insert(100, 101, 1);
+    result.clear();
+    ASSERT_TRUE(_cache->contains(EncodeKey(&result, 100)));
+    // contains() is not counted as a lookup
+    ASSERT_EQ(0, _cache->get_lookup_count());
+    ASSERT_EQ(0, _cache->get_hit_count());
+    Erase(100);
+    result.clear();
+    ASSERT_FALSE(_cache->contains(EncodeKey(&result, 100)));
+}
+
 TEST_F(CacheTest, Erase) {
     Erase(200);
     ASSERT_EQ(0, _deleted_keys.size());